@@ -0,0 +1,268 @@
+// Copyright (c) 2026 LazyDevelopers <lazydeveloper24@gmail.com>. All rights reserved.
+// This plugin is distributed under the Fab Standard License.
+//
+// This product was independently developed by us while participating in the Epic Project, a developer-support
+// program of the KRAFTON JUNGLE GameTech Lab. All rights, title, and interest in and to the product are exclusively
+// vested in us. Krafton, Inc. was not involved in its development and distribution and disclaims all representations
+// and warranties, express or implied, and assumes no responsibility or liability for any consequences arising from
+// the use of this product.
+
+#include "BooleanProcessor/BooleanCostModel.h"
+
+namespace
+{
+	// Triangle counts are scaled to thousands so all features stay within a few orders of magnitude.
+	constexpr double TriangleScale = 1.0 / 1000.0;
+
+	// Initial covariance (large = weak prior, first samples move the weights quickly).
+	constexpr double InitialCovariance = 1000.0;
+
+	// Smoothing for the per-tool triangle average.
+	constexpr double ToolTrisAlpha = 0.2;
+
+	// Ridge term added to the information matrix (P^-1) every sample. Directions that are never
+	// excited (tool triangles and union count move together) then settle at
+	// P = (1 - lambda) / Ridge = InitialCovariance instead of growing by 1/lambda per sample.
+	constexpr double RidgeTerm = (1.0 - FBooleanCostModel::ForgettingFactor) / InitialCovariance;
+
+	// Hard cap on trace(P); past it the covariance is reset to the prior.
+	constexpr double MaxCovarianceTrace = FBooleanCostModel::NumFeatures * InitialCovariance * 4.0;
+
+	/** In-place Gauss-Jordan inverse with partial pivoting. Returns false if the matrix is singular. */
+	bool InvertMatrix(double (&M)[FBooleanCostModel::NumFeatures][FBooleanCostModel::NumFeatures])
+	{
+		constexpr int32 N = FBooleanCostModel::NumFeatures;
+		double Inv[N][N];
+		for (int32 Row = 0; Row < N; ++Row)
+		{
+			for (int32 Col = 0; Col < N; ++Col)
+			{
+				Inv[Row][Col] = (Row == Col) ? 1.0 : 0.0;
+			}
+		}
+
+		for (int32 Pivot = 0; Pivot < N; ++Pivot)
+		{
+			int32 Best = Pivot;
+			for (int32 Row = Pivot + 1; Row < N; ++Row)
+			{
+				if (FMath::Abs(M[Row][Pivot]) > FMath::Abs(M[Best][Pivot]))
+				{
+					Best = Row;
+				}
+			}
+			if (FMath::Abs(M[Best][Pivot]) <= UE_DOUBLE_SMALL_NUMBER)
+			{
+				return false;
+			}
+			if (Best != Pivot)
+			{
+				for (int32 Col = 0; Col < N; ++Col)
+				{
+					Swap(M[Pivot][Col], M[Best][Col]);
+					Swap(Inv[Pivot][Col], Inv[Best][Col]);
+				}
+			}
+
+			const double InvPivot = 1.0 / M[Pivot][Pivot];
+			for (int32 Col = 0; Col < N; ++Col)
+			{
+				M[Pivot][Col] *= InvPivot;
+				Inv[Pivot][Col] *= InvPivot;
+			}
+
+			for (int32 Row = 0; Row < N; ++Row)
+			{
+				if (Row == Pivot)
+				{
+					continue;
+				}
+				const double Factor = M[Row][Pivot];
+				for (int32 Col = 0; Col < N; ++Col)
+				{
+					M[Row][Col] -= Factor * M[Pivot][Col];
+					Inv[Row][Col] -= Factor * Inv[Pivot][Col];
+				}
+			}
+		}
+
+		FMemory::Memcpy(M, Inv, sizeof(Inv));
+		return true;
+	}
+}
+
+void FBooleanCostModel::Reset()
+{
+	for (int32 Row = 0; Row < NumFeatures; ++Row)
+	{
+		Weights[Row] = 0.0;
+	}
+	ResetCovariance();
+
+	SampleCount = 0;
+	LastChunkTriCount = 0;
+	AvgToolTrisPerUnion = 0.0;
+	LastPredictedMs = 0.0;
+	LastMeasuredMs = 0.0;
+}
+
+void FBooleanCostModel::MakeFeatures(int32 ChunkTriCount, int32 ToolTriCount, int32 UnionCount, double (&OutFeatures)[NumFeatures])
+{
+	OutFeatures[0] = 1.0;
+	OutFeatures[1] = ChunkTriCount * TriangleScale;
+	OutFeatures[2] = ToolTriCount * TriangleScale;
+	OutFeatures[3] = UnionCount;
+}
+
+void FBooleanCostModel::ResetCovariance()
+{
+	for (int32 Row = 0; Row < NumFeatures; ++Row)
+	{
+		for (int32 Col = 0; Col < NumFeatures; ++Col)
+		{
+			Covariance[Row][Col] = (Row == Col) ? InitialCovariance : 0.0;
+		}
+	}
+}
+
+double FBooleanCostModel::Predict(int32 ChunkTriCount, int32 ToolTriCount, int32 UnionCount) const
+{
+	double X[NumFeatures];
+	MakeFeatures(ChunkTriCount, ToolTriCount, UnionCount, X);
+
+	double Result = 0.0;
+	for (int32 i = 0; i < NumFeatures; ++i)
+	{
+		Result += Weights[i] * X[i];
+	}
+	return FMath::Max(0.0, Result);
+}
+
+void FBooleanCostModel::AddSample(int32 ChunkTriCount, int32 ToolTriCount, int32 UnionCount, double DurationMs)
+{
+	if (UnionCount <= 0 || !FMath::IsFinite(DurationMs))
+	{
+		return;
+	}
+
+	LastPredictedMs = Predict(ChunkTriCount, ToolTriCount, UnionCount);
+	LastMeasuredMs = DurationMs;
+
+	double X[NumFeatures];
+	MakeFeatures(ChunkTriCount, ToolTriCount, UnionCount, X);
+
+	// PX = P * x, Denom = lambda + x^T * P * x
+	double PX[NumFeatures];
+	double Denom = ForgettingFactor;
+	for (int32 Row = 0; Row < NumFeatures; ++Row)
+	{
+		PX[Row] = 0.0;
+		for (int32 Col = 0; Col < NumFeatures; ++Col)
+		{
+			PX[Row] += Covariance[Row][Col] * X[Col];
+		}
+		Denom += X[Row] * PX[Row];
+	}
+
+	if (Denom <= UE_DOUBLE_SMALL_NUMBER)
+	{
+		// P lost positive definiteness (round-off); restart from the prior and keep the weights.
+		ResetCovariance();
+		return;
+	}
+
+	// Gain K = PX / Denom, then w += K * (y - w^T x).
+	double Error = DurationMs;
+	for (int32 i = 0; i < NumFeatures; ++i)
+	{
+		Error -= Weights[i] * X[i];
+	}
+
+	for (int32 Row = 0; Row < NumFeatures; ++Row)
+	{
+		Weights[Row] += (PX[Row] / Denom) * Error;
+	}
+
+	// P = (P - K * PX^T) / lambda (P stays symmetric).
+	for (int32 Row = 0; Row < NumFeatures; ++Row)
+	{
+		for (int32 Col = 0; Col < NumFeatures; ++Col)
+		{
+			Covariance[Row][Col] = (Covariance[Row][Col] - PX[Row] * PX[Col] / Denom) / ForgettingFactor;
+		}
+	}
+
+	// Ridge: P = (P^-1 + Ridge * I)^-1, keeps P bounded along unexcited directions.
+	bool bCovarianceValid = InvertMatrix(Covariance);
+	if (bCovarianceValid)
+	{
+		for (int32 i = 0; i < NumFeatures; ++i)
+		{
+			Covariance[i][i] += RidgeTerm;
+		}
+		bCovarianceValid = InvertMatrix(Covariance);
+	}
+
+	// Re-symmetrize to stop round-off from accumulating.
+	for (int32 Row = 0; Row < NumFeatures; ++Row)
+	{
+		for (int32 Col = Row + 1; Col < NumFeatures; ++Col)
+		{
+			const double Avg = 0.5 * (Covariance[Row][Col] + Covariance[Col][Row]);
+			Covariance[Row][Col] = Avg;
+			Covariance[Col][Row] = Avg;
+		}
+	}
+
+	double Trace = 0.0;
+	for (int32 i = 0; i < NumFeatures; ++i)
+	{
+		Trace += Covariance[i][i];
+	}
+	if (!bCovarianceValid || !FMath::IsFinite(Trace) || Trace > MaxCovarianceTrace)
+	{
+		ResetCovariance();
+	}
+
+	for (int32 i = 0; i < NumFeatures; ++i)
+	{
+		if (!FMath::IsFinite(Weights[i]))
+		{
+			// Numerical blow-up: fall back to the step heuristic until the model refits.
+			Reset();
+			return;
+		}
+	}
+
+	LastChunkTriCount = ChunkTriCount;
+	const double ToolTrisPerUnion = static_cast<double>(ToolTriCount) / UnionCount;
+	AvgToolTrisPerUnion = (SampleCount == 0)
+		? ToolTrisPerUnion
+		: FMath::Lerp(AvgToolTrisPerUnion, ToolTrisPerUnion, ToolTrisAlpha);
+
+	++SampleCount;
+}
+
+int32 FBooleanCostModel::SolveUnionCount(double TargetMs, int32 MaxCount) const
+{
+	MaxCount = FMath::Max(1, MaxCount);
+
+	// Cost at n unions: Fixed + PerUnion * n (tool triangles grow with n).
+	const double Fixed = Weights[0] + Weights[1] * LastChunkTriCount * TriangleScale;
+	const double PerUnion = Weights[2] * AvgToolTrisPerUnion * TriangleScale + Weights[3];
+
+	if (PerUnion <= UE_DOUBLE_SMALL_NUMBER)
+	{
+		// Extra tools are free according to the fit; only the fixed part can blow the budget.
+		return (Fixed <= TargetMs) ? MaxCount : 1;
+	}
+
+	const int32 Count = FMath::FloorToInt32((TargetMs - Fixed) / PerUnion);
+	return FMath::Clamp(Count, 1, MaxCount);
+}
+
+double FBooleanCostModel::PredictForUnionCount(int32 UnionCount) const
+{
+	const int32 ToolTriCount = FMath::RoundToInt32(AvgToolTrisPerUnion * UnionCount);
+	return Predict(LastChunkTriCount, ToolTriCount, UnionCount);
+}
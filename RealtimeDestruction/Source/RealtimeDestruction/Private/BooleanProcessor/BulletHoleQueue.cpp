@@ -0,0 +1,152 @@
+// Copyright (c) 2026 LazyDevelopers <lazydeveloper24@gmail.com>. All rights reserved.
+// This plugin is distributed under the Fab Standard License.
+//
+// This product was independently developed by us while participating in the Epic Project, a developer-support
+// program of the KRAFTON JUNGLE GameTech Lab. All rights, title, and interest in and to the product are exclusively
+// vested in us. Krafton, Inc. was not involved in its development and distribution and disclaims all representations
+// and warranties, express or implied, and assumes no responsibility or liability for any consequences arising from
+// the use of this product.
+
+
+#include "BooleanProcessor/BulletHoleQueue.h"
+
+void FBulletHoleQueue::Initialize(int32 InCapacity)
+{
+	Capacity = static_cast<int32>(FMath::RoundUpToPowerOfTwo(static_cast<uint32>(FMath::Max(InCapacity, 2))));
+	Mask = static_cast<uint64>(Capacity - 1);
+
+	Sequences = MakeUnique<std::atomic<uint64>[]>(Capacity);
+	for (int32 i = 0; i < Capacity; ++i)
+	{
+		Sequences[i].store(static_cast<uint64>(i), std::memory_order_relaxed);
+	}
+
+	ToolTransforms.SetNum(Capacity);
+	Attempts.SetNumZeroed(Capacity);
+	bIsPenetrations.SetNumZeroed(Capacity);
+	TemporaryDecals.SetNum(Capacity);
+	ToolMeshPtrs.SetNum(Capacity);
+	TargetMeshes.SetNum(Capacity);
+	ChunkIndices.Init(INDEX_NONE, Capacity);
+	BatchIds.Init(INDEX_NONE, Capacity);
+
+	EnqueuePos.store(0, std::memory_order_relaxed);
+	DequeuePos.store(0, std::memory_order_relaxed);
+	RejectedCount.store(0, std::memory_order_relaxed);
+}
+
+void FBulletHoleQueue::Reset()
+{
+	// Dequeue releases the slot's decal/tool references as it goes.
+	FBulletHole Temp;
+	while (Dequeue(Temp))
+	{
+		Temp.Reset();
+	}
+}
+
+bool FBulletHoleQueue::Enqueue(FBulletHole&& Op)
+{
+	return EnqueueInternal(MoveTemp(Op));
+}
+
+bool FBulletHoleQueue::Enqueue(const FBulletHole& Op)
+{
+	return EnqueueInternal(Op);
+}
+
+template <typename OpType>
+bool FBulletHoleQueue::EnqueueInternal(OpType&& Op)
+{
+	if (Capacity == 0)
+	{
+		RejectedCount.fetch_add(1, std::memory_order_relaxed);
+		return false;
+	}
+
+	uint64 Pos = EnqueuePos.load(std::memory_order_relaxed);
+	for (;;)
+	{
+		const uint64 Index = Pos & Mask;
+		const uint64 Sequence = Sequences[Index].load(std::memory_order_acquire);
+		const int64 Diff = static_cast<int64>(Sequence) - static_cast<int64>(Pos);
+
+		if (Diff == 0)
+		{
+			// Slot is free for this lap; claim it.
+			if (EnqueuePos.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed))
+			{
+				ToolTransforms[Index] = Forward<OpType>(Op).ToolTransform;
+				Attempts[Index] = Op.Attempts;
+				bIsPenetrations[Index] = Op.bIsPenetration;
+				TemporaryDecals[Index] = Forward<OpType>(Op).TemporaryDecal;
+				ToolMeshPtrs[Index] = Forward<OpType>(Op).ToolMeshPtr;
+				TargetMeshes[Index] = Forward<OpType>(Op).TargetMesh;
+				ChunkIndices[Index] = Op.ChunkIndex;
+				BatchIds[Index] = Op.BatchId;
+
+				// Publish to the consumer.
+				Sequences[Index].store(Pos + 1, std::memory_order_release);
+				return true;
+			}
+		}
+		else if (Diff < 0)
+		{
+			// The consumer has not freed this slot yet: the ring is full.
+			RejectedCount.fetch_add(1, std::memory_order_relaxed);
+			return false;
+		}
+		else
+		{
+			// Another producer claimed this position first.
+			Pos = EnqueuePos.load(std::memory_order_relaxed);
+		}
+	}
+}
+
+bool FBulletHoleQueue::Dequeue(FBulletHole& OutOp)
+{
+	if (Capacity == 0)
+	{
+		return false;
+	}
+
+	const uint64 Pos = DequeuePos.load(std::memory_order_relaxed);
+	const uint64 Index = Pos & Mask;
+	if (Sequences[Index].load(std::memory_order_acquire) != Pos + 1)
+	{
+		return false;
+	}
+
+	OutOp.ToolTransform = ToolTransforms[Index];
+	OutOp.Attempts = Attempts[Index];
+	OutOp.bIsPenetration = bIsPenetrations[Index];
+	OutOp.TemporaryDecal = MoveTemp(TemporaryDecals[Index]);
+	OutOp.ToolMeshPtr = MoveTemp(ToolMeshPtrs[Index]);
+	OutOp.TargetMesh = MoveTemp(TargetMeshes[Index]);
+	OutOp.ChunkIndex = ChunkIndices[Index];
+	OutOp.BatchId = BatchIds[Index];
+
+	// Hand the slot back to producers for the next lap.
+	Sequences[Index].store(Pos + Mask + 1, std::memory_order_release);
+	DequeuePos.store(Pos + 1, std::memory_order_relaxed);
+	return true;
+}
+
+bool FBulletHoleQueue::IsEmpty() const
+{
+	if (Capacity == 0)
+	{
+		return true;
+	}
+
+	const uint64 Pos = DequeuePos.load(std::memory_order_relaxed);
+	return Sequences[Pos & Mask].load(std::memory_order_acquire) != Pos + 1;
+}
+
+int32 FBulletHoleQueue::Num() const
+{
+	const uint64 Head = EnqueuePos.load(std::memory_order_relaxed);
+	const uint64 Tail = DequeuePos.load(std::memory_order_relaxed);
+	return Head > Tail ? static_cast<int32>(FMath::Min<uint64>(Head - Tail, static_cast<uint64>(Capacity))) : 0;
+}
@@ -0,0 +1,125 @@
+// Copyright (c) 2026 LazyDevelopers <lazydeveloper24@gmail.com>. All rights reserved.
+// This plugin is distributed under the Fab Standard License.
+//
+// This product was independently developed by us while participating in the Epic Project, a developer-support
+// program of the KRAFTON JUNGLE GameTech Lab. All rights, title, and interest in and to the product are exclusively
+// vested in us. Krafton, Inc. was not involved in its development and distribution and disclaims all representations
+// and warranties, express or implied, and assumes no responsibility or liability for any consequences arising from
+// the use of this product.
+
+
+#include "BooleanProcessor/ChunkSplitter.h"
+#include "Operations/MeshPlaneCut.h"
+#include "StructuralIntegrity/GridCellTypes.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+using namespace UE::Geometry;
+
+bool FChunkSplitter::BuildPlan(const FBox& Region, const FGridCellLayout& Layout, FPlan& OutPlan)
+{
+	OutPlan = FPlan();
+	if (!Region.IsValid)
+	{
+		return false;
+	}
+
+	const bool bUseGrid = Layout.IsValid();
+	const FVector Center = Region.GetCenter();
+	const FVector Size = Region.GetSize();
+
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		OutPlan.SplitPoint[Axis] = Center[Axis];
+
+		if (!bUseGrid)
+		{
+			OutPlan.bSplitAxis[Axis] = Size[Axis] > KINDA_SMALL_NUMBER;
+			continue;
+		}
+
+		const double CellSize = Layout.CellSize[Axis];
+		if (CellSize <= KINDA_SMALL_NUMBER || Size[Axis] < CellSize * MinCellsPerSide * 2)
+		{
+			continue;
+		}
+
+		// Snap to the grid line nearest the center, keeping MinCellsPerSide cells on each side.
+		const double Origin = Layout.GridOrigin[Axis];
+		const double Snapped = Origin + FMath::RoundToDouble((Center[Axis] - Origin) / CellSize) * CellSize;
+		const double Low = Region.Min[Axis] + CellSize * MinCellsPerSide;
+		const double High = Region.Max[Axis] - CellSize * MinCellsPerSide;
+		if (Snapped < Low || Snapped > High)
+		{
+			continue;
+		}
+
+		OutPlan.SplitPoint[Axis] = Snapped;
+		OutPlan.bSplitAxis[Axis] = true;
+	}
+
+	return OutPlan.GetAxisCount() > 0;
+}
+
+void FChunkSplitter::SplitMesh(const FDynamicMesh3& Mesh, const FTransform& ChunkToOwner, const FBox& Region,
+	const FPlan& Plan, TArray<FPart>& OutParts)
+{
+#if !UE_BUILD_SHIPPING
+	TRACE_CPUPROFILER_EVENT_SCOPE("ChunkSplitter_SplitMesh");
+#endif
+	OutParts.Reset();
+
+	// Planes are defined in owner space; normals map back with the inverse transpose.
+	const FMatrix ChunkToOwnerTransposed = ChunkToOwner.ToMatrixWithScale().GetTransposed();
+	const FVector3d LocalSplitPoint = ChunkToOwner.InverseTransformPosition(Plan.SplitPoint);
+
+	const int32 PartCount = Plan.GetMaxPartCount();
+	for (int32 PartCode = 0; PartCode < PartCount; ++PartCode)
+	{
+		FPart Part;
+		Part.Region = Region;
+		Part.Mesh = Mesh;
+
+		int32 Bit = 0;
+		for (int32 Axis = 0; Axis < 3; ++Axis)
+		{
+			if (!Plan.bSplitAxis[Axis])
+			{
+				continue;
+			}
+
+			const bool bHighSide = (PartCode >> Bit++) & 1;
+			if (bHighSide)
+			{
+				Part.Region.Min[Axis] = Plan.SplitPoint[Axis];
+			}
+			else
+			{
+				Part.Region.Max[Axis] = Plan.SplitPoint[Axis];
+			}
+
+			// FMeshPlaneCut removes the side the normal points to.
+			FVector AxisDirection = FVector::ZeroVector;
+			AxisDirection[Axis] = bHighSide ? -1.0 : 1.0;
+			const FVector3d LocalNormal = ChunkToOwnerTransposed.TransformVector(AxisDirection).GetSafeNormal();
+
+			FMeshPlaneCut Cut(&Part.Mesh, LocalSplitPoint, LocalNormal);
+			if (Cut.Cut())
+			{
+				Cut.SimpleHoleFill();
+			}
+
+			if (Part.Mesh.TriangleCount() == 0)
+			{
+				break;
+			}
+		}
+
+		if (Part.Mesh.TriangleCount() == 0)
+		{
+			continue;
+		}
+
+		Part.Mesh.CompactInPlace();
+		OutParts.Add(MoveTemp(Part));
+	}
+}
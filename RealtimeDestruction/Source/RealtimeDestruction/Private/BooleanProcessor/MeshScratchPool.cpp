@@ -0,0 +1,119 @@
+// Copyright (c) 2026 LazyDevelopers <lazydeveloper24@gmail.com>. All rights reserved.
+// This plugin is distributed under the Fab Standard License.
+//
+// This product was independently developed by us while participating in the Epic Project, a developer-support
+// program of the KRAFTON JUNGLE GameTech Lab. All rights, title, and interest in and to the product are exclusively
+// vested in us. Krafton, Inc. was not involved in its development and distribution and disclaims all representations
+// and warranties, express or implied, and assumes no responsibility or liability for any consequences arising from
+// the use of this product.
+
+
+#include "BooleanProcessor/MeshScratchPool.h"
+#include "ProfilingDebugging/CountersTrace.h"
+
+using namespace UE::Geometry;
+
+TRACE_DECLARE_INT_COUNTER(Counter_ScratchMeshAllocated, TEXT("RealtimeDestruction/ScratchMesh/Allocated"));
+TRACE_DECLARE_INT_COUNTER(Counter_ScratchMeshReused, TEXT("RealtimeDestruction/ScratchMesh/Reused"));
+
+namespace
+{
+	std::atomic<int64> AcquiredCount{0};
+	std::atomic<int64> ReusedCount{0};
+	std::atomic<int64> AllocatedCount{0};
+	std::atomic<int64> DroppedCount{0};
+	std::atomic<int64> DetachedCount{0};
+
+	TArray<TUniquePtr<FDynamicMesh3>>& GetThreadFreeList()
+	{
+		static thread_local TArray<TUniquePtr<FDynamicMesh3>> FreeList;
+		return FreeList;
+	}
+}
+
+FMeshScratchPool::FScopedMesh::~FScopedMesh()
+{
+	if (Mesh.IsValid())
+	{
+		FMeshScratchPool::Release(MoveTemp(Mesh));
+	}
+}
+
+FMeshScratchPool::FScopedMesh& FMeshScratchPool::FScopedMesh::operator=(FScopedMesh&& Other)
+{
+	if (this != &Other)
+	{
+		if (Mesh.IsValid())
+		{
+			FMeshScratchPool::Release(MoveTemp(Mesh));
+		}
+		Mesh = MoveTemp(Other.Mesh);
+	}
+	return *this;
+}
+
+FDynamicMesh3 FMeshScratchPool::FScopedMesh::Detach()
+{
+	check(Mesh.IsValid());
+	DetachedCount.fetch_add(1, std::memory_order_relaxed);
+
+	// The storage leaves with the contents, so the emptied shell is not worth pooling.
+	FDynamicMesh3 Out = MoveTemp(*Mesh);
+	Mesh.Reset();
+	return Out;
+}
+
+FMeshScratchPool::FScopedMesh FMeshScratchPool::Acquire()
+{
+	AcquiredCount.fetch_add(1, std::memory_order_relaxed);
+
+	TArray<TUniquePtr<FDynamicMesh3>>& FreeList = GetThreadFreeList();
+	if (FreeList.Num() > 0)
+	{
+		TRACE_COUNTER_SET(Counter_ScratchMeshReused, ReusedCount.fetch_add(1, std::memory_order_relaxed) + 1);
+		return FScopedMesh(FreeList.Pop(EAllowShrinking::No));
+	}
+
+	TRACE_COUNTER_SET(Counter_ScratchMeshAllocated, AllocatedCount.fetch_add(1, std::memory_order_relaxed) + 1);
+	return FScopedMesh(MakeUnique<FDynamicMesh3>());
+}
+
+FMeshScratchPool::FScopedMesh FMeshScratchPool::AcquireCopy(const FDynamicMesh3& Source)
+{
+	FScopedMesh Scratch = Acquire();
+	*Scratch = Source;
+	return Scratch;
+}
+
+void FMeshScratchPool::Release(TUniquePtr<FDynamicMesh3>&& Mesh)
+{
+	TArray<TUniquePtr<FDynamicMesh3>>& FreeList = GetThreadFreeList();
+	if (FreeList.Num() >= MaxMeshesPerThread || Mesh->MaxTriangleID() > MaxRetainedTriangles)
+	{
+		DroppedCount.fetch_add(1, std::memory_order_relaxed);
+		Mesh.Reset();
+		return;
+	}
+
+	FreeList.Add(MoveTemp(Mesh));
+}
+
+FMeshScratchPool::FStats FMeshScratchPool::GetStats()
+{
+	FStats Stats;
+	Stats.Acquired = AcquiredCount.load(std::memory_order_relaxed);
+	Stats.Reused = ReusedCount.load(std::memory_order_relaxed);
+	Stats.Allocated = AllocatedCount.load(std::memory_order_relaxed);
+	Stats.Dropped = DroppedCount.load(std::memory_order_relaxed);
+	Stats.Detached = DetachedCount.load(std::memory_order_relaxed);
+	return Stats;
+}
+
+void FMeshScratchPool::ResetStats()
+{
+	AcquiredCount.store(0, std::memory_order_relaxed);
+	ReusedCount.store(0, std::memory_order_relaxed);
+	AllocatedCount.store(0, std::memory_order_relaxed);
+	DroppedCount.store(0, std::memory_order_relaxed);
+	DetachedCount.store(0, std::memory_order_relaxed);
+}
@@ -22,8 +22,10 @@
 // DEBUG only
 #include "DebugConsoleVariables.h"
 #include "DynamicMesh/Operations/MergeCoincidentMeshEdges.h"
+#include "DynamicMeshEditor.h"
 #include "HAL/CriticalSection.h"
 #include "Subsystems/RDMThreadManagerSubsystem.h"
+#include "Settings/RDMSetting.h"
 #include "Remesher.h"
 #include "MeshConstraintsUtil.h"
 #include "Actors/DebrisActor.h"
@@ -32,12 +34,20 @@
 
 TRACE_DECLARE_INT_COUNTER(Counter_ThreadCount, TEXT("RealtimeDestruction/ThreadCount"));
 TRACE_DECLARE_INT_COUNTER(Counter_UnionThreadCount, TEXT("RealtimeDestruction/UnionThreadCount"));
+TRACE_DECLARE_INT_COUNTER(Counter_RejectedBulletHoles, TEXT("RealtimeDestruction/RejectedBulletHoles"));
+TRACE_DECLARE_INT_COUNTER(Counter_WastedBooleanMs, TEXT("RealtimeDestruction/WastedBooleanMs"));
+TRACE_DECLARE_INT_COUNTER(Counter_CulledTools, TEXT("RealtimeDestruction/CulledTools"));
+
+std::atomic<int64> FRealtimeBooleanProcessor::CulledToolCount{0};
 TRACE_DECLARE_INT_COUNTER(Counter_SubtractWorkerCount, TEXT("RealtimeDestruction/SubtractThreadCount"));
 TRACE_DECLARE_INT_COUNTER(Counter_ActiveChunks, TEXT("RealtimeDestruction/ActiveChunks"));
 
 TRACE_DECLARE_FLOAT_COUNTER(Counter_Throughput, TEXT("RealtimeDestruction/Throughput"));
 TRACE_DECLARE_INT_COUNTER(Counter_BatchSize, TEXT("RealtimeDestruction/BatchSize"));
 TRACE_DECLARE_FLOAT_COUNTER(Counter_WorkTime, TEXT("RealtimeDestruction/WorkTimeMs"));
+TRACE_DECLARE_INT_COUNTER(Counter_PendingCompletions, TEXT("RealtimeDestruction/PendingCompletions"));
+TRACE_DECLARE_FLOAT_COUNTER(Counter_PredictedBooleanMs, TEXT("RealtimeDestruction/PredictedBooleanMs"));
+TRACE_DECLARE_FLOAT_COUNTER(Counter_MeasuredBooleanMs, TEXT("RealtimeDestruction/MeasuredBooleanMs"));
 
 using namespace UE::Geometry;
 
@@ -62,32 +72,57 @@ bool FRealtimeBooleanProcessor::Initialize(URealtimeDestructibleMeshComponent* O
 
 	InitInterval = OwnerComponent->GetInitInterval();
 
+	// Request queues are preallocated rings; nothing is allocated per enqueue afterwards.
+	const URDMSetting* Setting = URDMSetting::Get();
+	const int32 QueueCapacity = Setting ? Setting->BooleanRequestQueueCapacity : 2048;
+	HighPriorityQueue.Initialize(QueueCapacity);
+	NormalPriorityQueue.Initialize(QueueCapacity);
+
 	int32 ChunkNum = OwnerComponent->GetChunkNum();
 	if (ChunkNum > 0)
 	{
-		ChunkGenerations.SetNumZeroed(ChunkNum);
-		ChunkStates.Initialize(ChunkNum);
-		ChunkHoleCount.SetNumZeroed(ChunkNum);
-		MaxInterval.Init(InitInterval, ChunkNum);
-		SetMeshAvgCost.SetNumZeroed(ChunkNum);
+		/*
+		 * Per-chunk arrays are sized once, with room for chunks added by runtime splits:
+		 * workers index them concurrently, so they must never reallocate.
+		 */
+		const int32 ChunkCapacity = ChunkNum + (Setting && Setting->bEnableRuntimeChunkSplit ? FMath::Max(0, Setting->MaxRuntimeSplitChunks) : 0);
+
+		ChunkGenerations.SetNumZeroed(ChunkCapacity);
+		ChunkWorkEpochs.SetNumZeroed(ChunkCapacity);
+		ChunkStates.Initialize(ChunkCapacity);
+		ChunkHoleCount.SetNumZeroed(ChunkCapacity);
+		MaxInterval.Init(InitInterval, ChunkCapacity);
+		SetMeshAvgCost.SetNumZeroed(ChunkCapacity);
 
 		// Start with an initial value of 10
-		MaxUnionCount.Init(10, ChunkNum);
+		MaxUnionCount.Init(10, ChunkCapacity);
+		ChunkCostModels.SetNum(ChunkCapacity);
 
 		// Initialize chunk multi-worker state
-		ChunkUnionResultsQueues.SetNum(ChunkNum);
+		ChunkUnionResultsQueues.SetNum(ChunkCapacity);
 		
-		for (int32 i = 0; i < ChunkNum; ++i)
+		for (int32 i = 0; i < ChunkCapacity; ++i)
 		{
 			ChunkUnionResultsQueues[i] = MakeUnique<TQueue<FUnionResult, EQueueMode::Mpsc>>();
 			
-			// Set LastSimplifyTriCount for chunk states
-			FDynamicMesh3 ChunkMesh;
-			OwnerComponent->GetChunkMesh(ChunkMesh, i);
-			ChunkStates.States[i].LastSimplifyTriCount = ChunkMesh.TriangleCount();
+			// Set LastSimplifyTriCount for chunk states (read in place, no copy).
+			if (i >= ChunkNum)
+			{
+				continue;
+			}
+			if (UDynamicMeshComponent* ChunkComp = OwnerComponent->GetChunkMeshComponent(i))
+			{
+				ChunkComp->ProcessMesh([&](const FDynamicMesh3& ChunkMesh)
+				{
+					ChunkStates.States[i].LastSimplifyTriCount = ChunkMesh.TriangleCount();
+				});
+			}
 		}
 
-		ChunkNextBatchIDs.SetNumZeroed(ChunkNum); 
+		ChunkNextBatchIDs.SetNumZeroed(ChunkCapacity); 
+
+		HighPriorityPending.Initialize(ChunkCapacity);
+		NormalPriorityPending.Initialize(ChunkCapacity);
 	}
 
 	LifeTime = MakeShared<FProcessorLifeTime, ESPMode::ThreadSafe>();
@@ -116,13 +151,19 @@ void FRealtimeBooleanProcessor::Shutdown()
 	LifeTime->Clear();
 	LifeTime.Reset();
 
-	FBulletHole Temp;
-	while (HighPriorityQueue.Dequeue(Temp)) {}
-	while (NormalPriorityQueue.Dequeue(Temp)) {}
+	HighPriorityQueue.Reset();
+	NormalPriorityQueue.Reset();
+	HighPriorityPending.Reset();
+	NormalPriorityPending.Reset();
 
 	DebugHighQueueCount = 0;
 	DebugNormalQueueCount = 0;
 
+	// Pending applies reference a dead lifetime token and would no-op anyway.
+	TUniqueFunction<void()> PendingCompletion;
+	while (CompletionQueue.Dequeue(PendingCompletion)) {}
+	PendingCompletionCount.store(0);
+
 	// Clear chunk queues
 	for (auto& Queue : ChunkUnionResultsQueues)
 	{
@@ -137,6 +178,12 @@ void FRealtimeBooleanProcessor::Shutdown()
 	ChunkNextBatchIDs.Empty(); 
 
 	ChunkGenerations.Empty();
+	ChunkWorkEpochs.Empty();
+
+	{
+		FScopeLock Lock(&CostModelLock);
+		ChunkCostModels.Empty();
+	}
 
 	ChunkStates.Shutdown();
 
@@ -224,18 +271,10 @@ void FRealtimeBooleanProcessor::EnqueueOp(FRealtimeDestructionOp&& Operation, UD
 	UE_LOG(LogTemp, Warning, TEXT("High Queue Size: %d"), DebugHighQueueCount);
 	UE_LOG(LogTemp, Warning, TEXT("Normal Queue Size: %d"), DebugNormalQueueCount);
 
-	if (Op.bIsPenetration)
+	if (PushBulletHole(MoveTemp(Op)))
 	{
-		HighPriorityQueue.Enqueue(MoveTemp(Op));
-		DebugHighQueueCount++;
-		UE_LOG(LogTemp, Warning, TEXT("[Enqueue] ✅ High Priority Queue Size: %d"), DebugHighQueueCount);
+		UE_LOG(LogTemp, Warning, TEXT("[Enqueue] ✅ High/Normal Priority Queue Size: %d/%d"), DebugHighQueueCount, DebugNormalQueueCount);
 	}
-	else
-	{
-		NormalPriorityQueue.Enqueue(MoveTemp(Op));
-		DebugNormalQueueCount++;
-		UE_LOG(LogTemp, Warning, TEXT("[Enqueue] ✅ Normal Priority Queue Size: %d"), DebugNormalQueueCount);
-	}	
 	}
 	else
 	{
@@ -245,16 +284,40 @@ void FRealtimeBooleanProcessor::EnqueueOp(FRealtimeDestructionOp&& Operation, UD
 
 void FRealtimeBooleanProcessor::EnqueueRemaining(FBulletHole&& Operation)
 {
-	if (Operation.bIsPenetration)
+	PushBulletHole(MoveTemp(Operation));
+}
+
+bool FRealtimeBooleanProcessor::PushBulletHole(FBulletHole&& Op)
+{
+	if (Op.bIsPenetration && HighPriorityQueue.Enqueue(MoveTemp(Op)))
 	{
-		HighPriorityQueue.Enqueue(MoveTemp(Operation));
 		DebugHighQueueCount++;
+		return true;
 	}
-	else
+
+	// Non-penetration requests, and penetration requests that found the high queue full.
+	if (NormalPriorityQueue.Enqueue(MoveTemp(Op)))
 	{
-		NormalPriorityQueue.Enqueue(MoveTemp(Operation));
 		DebugNormalQueueCount++;
+		return true;
+	}
+
+	RejectBulletHole(MoveTemp(Op));
+	return false;
+}
+
+void FRealtimeBooleanProcessor::RejectBulletHole(FBulletHole&& Op)
+{
+	const int64 RejectedCount = HighPriorityQueue.GetRejectedCount() + NormalPriorityQueue.GetRejectedCount();
+	TRACE_COUNTER_SET(Counter_RejectedBulletHoles, RejectedCount);
+	UE_LOG(LogTemp, Warning, TEXT("[Enqueue] Request queues full (capacity %d), skipping ChunkIndex %d"),
+		NormalPriorityQueue.GetCapacity(), Op.ChunkIndex);
+
+	if (OwnerComponent.IsValid())
+	{
+		OwnerComponent->NotifyBooleanSkipped(Op.BatchId);
 	}
+	Op.Reset();
 }
 
 void FRealtimeBooleanProcessor::EnqueueIslandRemoval(
@@ -323,24 +386,34 @@ URDMThreadManagerSubsystem* FRealtimeBooleanProcessor::GetThreadManager() const
 	return URDMThreadManagerSubsystem::Get(World);
 }
 
+ERDMWorkPriority FRealtimeBooleanProcessor::GetWorkPriority() const
+{
+	if (!OwnerComponent.IsValid())
+	{
+		return ERDMWorkPriority::OffScreen;
+	}
+
+	// Chunk components render instead of the owner, so ask the actor (any of its primitives).
+	const AActor* Owner = OwnerComponent->GetOwner();
+	const bool bVisible = Owner ? Owner->WasRecentlyRendered(VisibleWorkTolerance) : OwnerComponent->WasRecentlyRendered(VisibleWorkTolerance);
+	return bVisible ? ERDMWorkPriority::Visible : ERDMWorkPriority::OffScreen;
+}
+
 void FRealtimeBooleanProcessor::InitializeSlots()
 {
 	if (URDMThreadManagerSubsystem* ThreadManager = GetThreadManager())
 	{
 		NumSlots = ThreadManager->GetSlotCount();
+		CachedThreadManager = ThreadManager;
+
+		// Slots only run island-removal subtracts; bullet holes go through the chunk task pipeline.
+		MaxSubtractWorkerPerSlot = FMath::Max(1, ThreadManager->GetMaxTotalWorkers() / NumSlots);
 	}
 	else
 	{
 		NumSlots = 1;
 	}
 	
-	// Create union queues.
-	SlotUnionQueues.SetNum(NumSlots);
-	for (int32 i = 0; i < NumSlots; ++i)
-	{
-		SlotUnionQueues[i] = MakeUnique<TQueue<FBulletHoleBatch, EQueueMode::Mpsc>>();
-	}
-
 	// Create subtract queues.
 	SlotSubtractQueues.SetNum(NumSlots);
 	for (int32 i = 0; i < NumSlots; ++i)
@@ -348,35 +421,16 @@ void FRealtimeBooleanProcessor::InitializeSlots()
 		SlotSubtractQueues[i] = MakeUnique<TQueue<FUnionResult, EQueueMode::Mpsc>>();
 	} 
 
-	// Create active flags.
-	SlotUnionActiveFlags.SetNum(NumSlots);
-	SlotSubtractActiveFlags.SetNum(NumSlots);
-	SlotUnionWorkerCounts.SetNum(NumSlots);     
+	// Create worker counters.
 	SlotSubtractWorkerCounts.SetNum(NumSlots);
 	for (int32 i = 0; i < NumSlots; ++i)
 	{
-		SlotUnionActiveFlags[i] = MakeUnique<std::atomic<bool>>(false);
-		SlotSubtractActiveFlags[i] = MakeUnique<std::atomic<bool>>(false);
-
-		
-		SlotUnionWorkerCounts[i] = MakeUnique<std::atomic<int32>>(0);
 		SlotSubtractWorkerCounts[i] = MakeUnique<std::atomic<int32>>(0);
-	}	 
+	}
 }
 
 void FRealtimeBooleanProcessor::ShutdownSlots()
 {
-	// Clear union queues.
-	  for (auto& Queue : SlotUnionQueues)
-	  {
-	  	if (Queue)
-	  	{
-	  		FBulletHoleBatch Dummy;
-	  		while (Queue->Dequeue(Dummy)) {} 
-	  	}
-	  }
-	SlotUnionQueues.Empty();
-
 	// Clear subtract queues.
 	for (auto& Queue : SlotSubtractQueues)
 	{
@@ -387,13 +441,6 @@ void FRealtimeBooleanProcessor::ShutdownSlots()
 		}
 	}
 	SlotSubtractQueues.Empty();
-   
-	// Clear flags.
-	SlotUnionActiveFlags.Empty();
-	 
-	SlotSubtractActiveFlags.Empty(); 
-	 
-	SlotUnionWorkerCounts.Empty();   
 
 	SlotSubtractWorkerCounts.Empty();
 }
@@ -406,7 +453,7 @@ int32 FRealtimeBooleanProcessor::FindLeastBusySlot() const
 	for (int32 i = 0; i < NumSlots; i++)
 	{
 		// Score based on active worker counts.
-		int32 Score = SlotUnionWorkerCounts[i]->load() + SlotSubtractWorkerCounts[i]->load() * 2;
+		int32 Score = SlotSubtractWorkerCounts[i]->load();
 
 		if (Score < MinScore)
 		{
@@ -418,178 +465,174 @@ int32 FRealtimeBooleanProcessor::FindLeastBusySlot() const
 	return BestSlot;
 }
 
-void FRealtimeBooleanProcessor::KickUnionWorker(int32 SlotIndex)
+int32 FRealtimeBooleanProcessor::ReserveWorkerSlot(TArray<TUniquePtr<std::atomic<int32>>>& WorkerCounts, int32 MaxPerSlot, int32 PreferredSlot) const
 {
-	// Dequeue first (safe on GameThread only).
-	FBulletHoleBatch Batch;
-	if (!SlotUnionQueues[SlotIndex]->Dequeue(Batch))
-	{
-		return;  // Queue is empty.
-	} 
-
-	// Check per-slot worker limit.
-	int32 Current = SlotUnionWorkerCounts[SlotIndex]->fetch_add(1);
-	if (Current >= MaxUnionWorkerPerSlot)
+	// Preferred slot first, then the others in ring order.
+	for (int32 Offset = 0; Offset < NumSlots; ++Offset)
 	{
-        SlotUnionWorkerCounts[SlotIndex]->fetch_sub(1);
-		SlotUnionQueues[SlotIndex]->Enqueue(Batch);
-		return;
+		const int32 SlotIndex = (PreferredSlot + Offset) % NumSlots;
+		if (WorkerCounts[SlotIndex]->fetch_add(1) < MaxPerSlot)
+		{
+			return SlotIndex;
+		}
+		WorkerCounts[SlotIndex]->fetch_sub(1);
 	}
-	
-	// Acquire ThreadManager.
-	URDMThreadManagerSubsystem* ThreadManager = GetThreadManager();
-	if (!ThreadManager)
+
+	return INDEX_NONE;
+}
+
+bool FRealtimeBooleanProcessor::StealSubtractWork(int32 SlotIndex, FUnionResult& OutResult)
+{
+	if (!OwnerComponent.IsValid())
 	{
-        SlotUnionWorkerCounts[SlotIndex]->fetch_sub(1);
-		SlotUnionQueues[SlotIndex]->Enqueue(MoveTemp(Batch));
-		return;
+		return false;
 	}
 
-	
-	// 4. Start worker (capture batch).
-	UE_LOG(LogTemp, Log, TEXT("[Slot %d] Union Worker Started: %d / %d"),
-		SlotIndex, SlotUnionWorkerCounts[SlotIndex]->load() , MaxUnionWorkerPerSlot);
+	for (int32 Offset = 0; Offset < NumSlots; ++Offset)
+	{
+		const int32 VictimSlot = (SlotIndex + Offset) % NumSlots;
 
-	TSharedPtr<FProcessorLifeTime, ESPMode::ThreadSafe> LifeTimeToken = LifeTime;
-	ThreadManager->RequestWork(
-		[LifeTimeToken, SlotIndex, Batch = MoveTemp(Batch)]() mutable
+		// Scan the whole queue (GameThread is the only consumer); it holds at most a few entries per chunk.
+		bool bFound = false;
+		TArray<FUnionResult> Skipped;
+		FUnionResult Candidate;
+		while (SlotSubtractQueues[VictimSlot]->Dequeue(Candidate))
 		{
-			if (!LifeTimeToken.IsValid() || !LifeTimeToken->bAlive.load())
+			if (OwnerComponent->CheckAndSetChunkBusy(Candidate.ChunkIndex))
 			{
-				return;
+				Skipped.Add(MoveTemp(Candidate));
+				continue;
 			}
-			if (auto Processor = LifeTimeToken->Processor.Pin())
+
+			if (VictimSlot != SlotIndex)
 			{
-				Processor->ProcessSlotUnionWork(SlotIndex, MoveTemp(Batch));
-			}			
-		},
-		OwnerComponent.Get()
-	);	
+				UE_LOG(LogTemp, Verbose, TEXT("[Slot %d] Stole subtract work from slot %d (Chunk %d)"),
+					SlotIndex, VictimSlot, Candidate.ChunkIndex);
+			}
+
+			OutResult = MoveTemp(Candidate);
+			bFound = true;
+			break;
+		}
+
+		// Anything after the runnable entry has to stay behind the skipped ones.
+		while (bFound && SlotSubtractQueues[VictimSlot]->Dequeue(Candidate))
+		{
+			Skipped.Add(MoveTemp(Candidate));
+		}
+
+		// Waiting entries go back to the owning queue, keeping their relative order.
+		for (FUnionResult& Waiting : Skipped)
+		{
+			SlotSubtractQueues[VictimSlot]->Enqueue(MoveTemp(Waiting));
+		}
+
+		if (bFound)
+		{
+			return true;
+		}
+	}
+
+	return false;
 }
 
 void FRealtimeBooleanProcessor::KickSubtractWorker(int32 SlotIndex)
 {
-	// Dequeue first (safe on GameThread only).
-	FUnionResult UnionResult;
-	if (!SlotSubtractQueues[SlotIndex]->Dequeue(UnionResult))
+	// Reserve a worker thread on this slot, or on any slot that still has capacity.
+	const int32 WorkerSlot = ReserveWorkerSlot(SlotSubtractWorkerCounts, MaxSubtractWorkerPerSlot, SlotIndex);
+	if (WorkerSlot == INDEX_NONE)
 	{
-		return;  // Queue is empty.
+		return;  // Every slot is at max; a finishing worker kicks again.
 	}
 
-	// Reserve per-slot worker thread.
-	int32 Current = SlotSubtractWorkerCounts[SlotIndex]->fetch_add(1);
-	if (Current >= MaxSubtractWorkerPerSlot)
+	// Dequeue (safe on GameThread only). Sets the chunk busy bit of the returned result.
+	FUnionResult UnionResult;
+	if (!StealSubtractWork(WorkerSlot, UnionResult))
 	{
-		// At max -> rollback and re-enqueue UnionResult.
-		SlotSubtractWorkerCounts[SlotIndex]->fetch_sub(1);
-		SlotSubtractQueues[SlotIndex]->Enqueue(MoveTemp(UnionResult));
-		return;
+		SlotSubtractWorkerCounts[WorkerSlot]->fetch_sub(1);
+		return;  // Nothing runnable: empty, or only busy chunks.
 	}
 
 	// Acquire ThreadManager.
 	URDMThreadManagerSubsystem* ThreadManager = GetThreadManager();
 	if (!ThreadManager)
 	{ 
-		SlotSubtractWorkerCounts[SlotIndex]->fetch_sub(1);
-		SlotSubtractQueues[SlotIndex]->Enqueue(MoveTemp(UnionResult));
+		SlotSubtractWorkerCounts[WorkerSlot]->fetch_sub(1);
+		if (OwnerComponent.IsValid())
+		{
+			OwnerComponent->ClearChunkBusy(UnionResult.ChunkIndex);
+		}
+		SlotSubtractQueues[WorkerSlot]->Enqueue(MoveTemp(UnionResult));
 		return;
 	}
 
 	// Start worker (capture UnionResult).
 	UE_LOG(LogTemp, Log, TEXT("[Slot %d] Subtract Worker Started: %d / %d"),
-		SlotIndex, SlotSubtractWorkerCounts[SlotIndex]->load(), MaxSubtractWorkerPerSlot);
+		WorkerSlot, SlotSubtractWorkerCounts[WorkerSlot]->load(), MaxSubtractWorkerPerSlot);
 
 	TSharedPtr<FProcessorLifeTime, ESPMode::ThreadSafe> LifeTimeToken = LifeTime;
-	if (OwnerComponent.IsValid() && !OwnerComponent->CheckAndSetChunkBusy(UnionResult.ChunkIndex))
-	{
-		ThreadManager->RequestWork(
-		   [LifeTimeToken, SlotIndex, UnionResult = MoveTemp(UnionResult)]() mutable
-		   {
-		   	if (!LifeTimeToken.IsValid() || !LifeTimeToken->bAlive.load())
-		   	{
-		   		return;
-		   	}
-		   	if (auto Processor = LifeTimeToken->Processor.Pin())
-		   	{
-		   		Processor->ProcessSlotSubtractWork(SlotIndex, MoveTemp(UnionResult));
-		   	}
-		   },
-		   OwnerComponent.Get()
-	   );
-	}
-	else
-	{
-		SlotSubtractWorkerCounts[SlotIndex]->fetch_sub(1);
-		UE_LOG(LogTemp, Warning, TEXT("Re-enqueued due to ChunkBusy! ChunkIndex=%d, Context=%p"),
-			UnionResult.ChunkIndex, UnionResult.IslandContext.Get());
-		SlotSubtractQueues[SlotIndex]->Enqueue(MoveTemp(UnionResult));
-	}
+	ThreadManager->RequestWork(
+	   [LifeTimeToken, WorkerSlot, UnionResult = MoveTemp(UnionResult)]() mutable
+	   {
+	   	if (!LifeTimeToken.IsValid() || !LifeTimeToken->bAlive.load())
+	   	{
+	   		return;
+	   	}
+	   	if (auto Processor = LifeTimeToken->Processor.Pin())
+	   	{
+	   		Processor->ProcessSlotSubtractWork(WorkerSlot, MoveTemp(UnionResult));
+	   	}
+	   },
+	   OwnerComponent.Get(),
+	   ERDMWorkClass::IslandRemoval,
+	   GetWorkPriority()
+   );
 }
 
-void FRealtimeBooleanProcessor::ProcessSlotUnionWork(int32 SlotIndex, FBulletHoleBatch&& Batch)
+int32 FRealtimeBooleanProcessor::UnionToolMeshesTree(TArray<FMeshScratchPool::FScopedMesh>&& ToolMeshes, FDynamicMesh3& OutCombinedMesh, int32 ChunkIndex, int32 WorkEpoch)
 {
-	// Batch is passed as a parameter (no dequeue).
-	int32 ChunkIndex = Batch.ChunkIndex;
-	if (ChunkIndex == INDEX_NONE)
+	if (ToolMeshes.IsEmpty())
 	{
-		SlotUnionWorkerCounts[SlotIndex]->fetch_sub(1);
-		return;
+		return 0;
 	}
 
-	// Perform union (no chunk mesh access; tool meshes only).
-	FDynamicMesh3 CombinedToolMesh;
-	TArray<TWeakObjectPtr<UDecalComponent>> Decals;
-	int32 UnionCount = 0;
+	// Number of original tools merged into each pending mesh.
+	TArray<int32> MergedCounts;
+	MergedCounts.Init(1, ToolMeshes.Num());
 
-	int32 BatchCount = Batch.Num();
-	TArray<FTransform> ToolTransforms = MoveTemp(Batch.ToolTransforms);
-	TArray<TWeakObjectPtr<UDecalComponent>> TemporaryDecals = MoveTemp(Batch.TemporaryDecals);
-	TArray<TSharedPtr<FDynamicMesh3, ESPMode::ThreadSafe>> ToolMeshPtrs = MoveTemp(
-		Batch.ToolMeshPtrs);
+	URDMThreadManagerSubsystem* ThreadManager = CachedThreadManager.Get();
 
-	bool bIsFirst = true;
-	for (int32 i = 0; i < BatchCount; ++i)
+	while (ToolMeshes.Num() > 1)
 	{
-		if (!ToolMeshPtrs[i].IsValid())
+		// Chunk was reset or removed since this batch was queued: the remaining levels are wasted work.
+		if (IsChunkWorkStale(ChunkIndex, WorkEpoch))
 		{
-			continue;
+			return 0;
 		}
 
-		FTransform ToolTransform = MoveTemp(ToolTransforms[i]);
-		TWeakObjectPtr<UDecalComponent> TemporaryDecal = MoveTemp(TemporaryDecals[i]);
-
-		// Skip empty meshes (avoid crash).
-		FDynamicMesh3 CurrentTool = *(ToolMeshPtrs[i]);
-		if (CurrentTool.TriangleCount() == 0)
-		{
-			UE_LOG(LogTemp, Warning,
-			       TEXT(
-				       "[UnionWorkerForChunk] Skipping empty ToolMesh at ChunkIndex %d, item %d"
-			       ), ChunkIndex, i);
-			continue;
-		}
+#if !UE_BUILD_SHIPPING
+		TRACE_CPUPROFILER_EVENT_SCOPE("SlotWorkerUnion_TreeLevel");
+#endif
+		const int32 PairCount = ToolMeshes.Num() / 2;
+		const bool bHasOddMesh = (ToolMeshes.Num() % 2) != 0;
 
-		//FDynamicMesh3 CurrentTool = MoveTemp(*(ToolMeshPtrs[i]));
-		MeshTransforms::ApplyTransform(CurrentTool, (FTransformSRT3d)ToolTransform, true);
+		TArray<FMeshScratchPool::FScopedMesh> NextMeshes;
+		NextMeshes.SetNum(PairCount + (bHasOddMesh ? 1 : 0));
+		TArray<int32> NextCounts;
+		NextCounts.SetNumZeroed(NextMeshes.Num());
 
-		if (TemporaryDecal.IsValid())
+		// Each pair writes only to its own slot, so no locking is needed.
+		auto UnionPair = [&](int32 PairIndex)
 		{
-			Decals.Add(TemporaryDecal);
-		}
+			const int32 IndexA = PairIndex * 2;
+			const int32 IndexB = IndexA + 1;
 
-		if (bIsFirst)
-		{
-			CombinedToolMesh = MoveTemp(CurrentTool);
-			bIsFirst = false;
-			UnionCount++;
-		}
-		else
-		{
-			FDynamicMesh3 UnionResult;
+			// Leased on whichever thread runs the pair; the inputs return to this level's pools.
+			FMeshScratchPool::FScopedMesh UnionResult = FMeshScratchPool::Acquire();
 			FMeshBoolean MeshUnion(
-				&CombinedToolMesh, FTransform::Identity,
-				&CurrentTool, FTransform::Identity,
-				&UnionResult, FMeshBoolean::EBooleanOp::Union
+				ToolMeshes[IndexA].Get(), FTransform::Identity,
+				ToolMeshes[IndexB].Get(), FTransform::Identity,
+				UnionResult.Get(), FMeshBoolean::EBooleanOp::Union
 			);
 
 			bool bUnionSuccess = false;
@@ -602,72 +645,67 @@ void FRealtimeBooleanProcessor::ProcessSlotUnionWork(int32 SlotIndex, FBulletHol
 
 			if (bUnionSuccess)
 			{
-				CombinedToolMesh = MoveTemp(UnionResult);
-				UnionCount++;
-
-				UE_LOG(LogTemp, Display, TEXT("ToolMeshTri %d"), CombinedToolMesh.TriangleCount());
-				
+				NextMeshes[PairIndex] = MoveTemp(UnionResult);
+				NextCounts[PairIndex] = MergedCounts[IndexA] + MergedCounts[IndexB];
 			}
 			else
 			{
+				// Keep the left side, same as skipping the failed tool in a sequential fold.
 				UE_LOG(LogTemp, Warning,
-				       TEXT("[UnionWorkerForChunk] Union failed at ChunkIndex %d, item %d"),
-				       ChunkIndex, i);
+				       TEXT("[UnionWorkerForChunk] Union failed at ChunkIndex %d, pair %d"),
+				       ChunkIndex, PairIndex);
+				NextMeshes[PairIndex] = MoveTemp(ToolMeshes[IndexA]);
+				NextCounts[PairIndex] = MergedCounts[IndexA];
 			}
-		}
-	}
-
-	if (UnionCount > 0 && CombinedToolMesh.TriangleCount() > 0)
-	{
-		FUnionResult Result;
-		//Result.BatchID = BatchID;
-		Result.PendingCombinedToolMesh = MoveTemp(CombinedToolMesh);
-		Result.Decals = MoveTemp(Decals);
-		Result.UnionCount = UnionCount;
-		Result.ChunkIndex = ChunkIndex;
-		// 배치 완료 추적용 ID 배열 복사
-		Result.CompletionBatchIds = MoveTemp(Batch.CompletionBatchIds);
+		};
 
-		// Enqueue into subtract queue.
-		SlotSubtractQueues[SlotIndex]->Enqueue(MoveTemp(Result));
-	}
+		/*
+		 * The calling worker always takes a share of the pairs.
+		 * Extra workers come out of the thread manager's global budget; if none are free,
+		 * the level simply runs on this thread.
+		 */
+		const int32 HelperCount = (ThreadManager && PairCount > 1) ? ThreadManager->TryReserveWorkers(PairCount - 1) : 0;
+		const int32 GroupCount = HelperCount + 1;
 
-	SlotUnionWorkerCounts[SlotIndex]->fetch_sub(1);
+		auto RunGroup = [&UnionPair, PairCount, GroupCount](int32 GroupIndex)
+		{
+			for (int32 PairIndex = GroupIndex; PairIndex < PairCount; PairIndex += GroupCount)
+			{
+				UnionPair(PairIndex);
+			}
+		};
 
-	// Kick subtract (on GameThread).
-	AsyncTask(ENamedThreads::GameThread, [LifeTimeToken = LifeTime, SlotIndex]()
-	{
-		if (!LifeTimeToken.IsValid() || !LifeTimeToken->bAlive.load())
+		TArray<UE::Tasks::FTask> HelperTasks;
+		HelperTasks.Reserve(HelperCount);
+		for (int32 GroupIndex = 1; GroupIndex < GroupCount; ++GroupIndex)
 		{
-			return;
+			HelperTasks.Add(UE::Tasks::Launch(UE_SOURCE_LOCATION, [&RunGroup, GroupIndex]()
+			{
+				RunGroup(GroupIndex);
+			}));
 		}
 
-		if (auto Processor = LifeTimeToken->Processor.Pin())
+		RunGroup(0);
+		UE::Tasks::Wait(HelperTasks);
+
+		if (HelperCount > 0)
 		{
-			// If queue has work, kick again.
-			//if (!Processor->SlotUnionQueues[SlotIndex]->IsEmpty())
-			//{
-			//	Processor->KickUnionWorker(SlotIndex);
-			//}
+			ThreadManager->ReleaseReservedWorkers(HelperCount);
+		}
 
-			for (int32 i = 0; i < Processor->SlotUnionQueues.Num(); i++)
-			{
-				if (!Processor->SlotUnionQueues[i]->IsEmpty())
-				{
-					Processor->KickUnionWorker(i);
-				}
-			}
-			// Kick subtract worker too.
-			//Processor->KickSubtractWorker(SlotIndex);
-			 for (int32 i = 0; i < Processor->SlotSubtractQueues.Num(); i++)
-              {
-                  if (!Processor->SlotSubtractQueues[i]->IsEmpty())
-                  {
-                      Processor->KickSubtractWorker(i);
-                  }
-              }
+		// An odd mesh is carried up to the next level unchanged.
+		if (bHasOddMesh)
+		{
+			NextMeshes.Last() = MoveTemp(ToolMeshes.Last());
+			NextCounts.Last() = MergedCounts.Last();
 		}
-	});
+
+		ToolMeshes = MoveTemp(NextMeshes);
+		MergedCounts = MoveTemp(NextCounts);
+	}
+
+	OutCombinedMesh = ToolMeshes[0].Detach();
+	return MergedCounts[0];
 }
 
 void FRealtimeBooleanProcessor::ProcessSlotSubtractWork(int32 SlotIndex, FUnionResult&& UnionResult)
@@ -774,18 +812,20 @@ void FRealtimeBooleanProcessor::ProcessSlotSubtractWork(int32 SlotIndex, FUnionR
 		return;
 	}
 
-	// ===== 4. Subtract compute =====
+	// ===== 4. Subtract compute (island removal; bullet holes run in the chunk pipeline) =====
 	FDynamicMesh3 ResultMesh;
 	bool bSuccess = false; 
 	bool bHasDebris = false; 
+	FAxisAlignedBox3d DamageBounds = FAxisAlignedBox3d::Empty();
 	{	
-		// Fetch chunk mesh.
-		FDynamicMesh3 WorkMesh;
-		if (!OwnerComponent->GetChunkMesh(WorkMesh, ChunkIndex))
+		// Fetch a shared read-only snapshot of the chunk mesh (no deep copy).
+		FChunkMeshSnapshot ChunkSnapshot;
+		if (!OwnerComponent->AcquireChunkMeshSnapshot(ChunkIndex, ChunkSnapshot))
 		{
 			HandleFailureAndReturn();
 			return;
-		}		
+		}
+		const FDynamicMesh3& WorkMesh = *ChunkSnapshot.Mesh;
 
 		if (WorkMesh.TriangleCount() == 0)
 		{
@@ -793,127 +833,83 @@ void FRealtimeBooleanProcessor::ProcessSlotSubtractWork(int32 SlotIndex, FUnionR
 			return;
 		}
 
-		if (UnionResult.WorkType == EBooleanWorkType::BulletHole)
-		{
-			if (UnionResult.PendingCombinedToolMesh.TriangleCount() == 0)
-			{
-				// SlotSubtractWorkerCounts[SlotIndex]->fetch_sub(1);
-				// if (!SlotSubtractQueues[SlotIndex]->IsEmpty())
-				// {
-				// 	KickSubtractWorker(SlotIndex);
-				// }
-
-				HandleFailureAndReturn();
-				return;
-			}
+		FGeometryScriptMeshBooleanOptions Ops;
+		Ops.bFillHoles = true;
+		Ops.bSimplifyOutput = false;
 
-			// Run subtract.
-			FGeometryScriptMeshBooleanOptions Options = OwnerComponent->GetBooleanOptions();
+		// Intersection (Debris): 원본 크기 DebrisToolMesh 사용
+		if (UnionResult.DebrisSharedToolMesh.IsValid() && UnionResult.IslandContext.IsValid())
+		{
+			FMeshScratchPool::FScopedMesh DebrisTool = FMeshScratchPool::AcquireCopy(*UnionResult.DebrisSharedToolMesh);
+			FMeshScratchPool::FScopedMesh Debris = FMeshScratchPool::Acquire();
 
-			double CurrentSubtractDurationMs = FPlatformTime::Seconds();
+			UE_LOG(LogTemp, Warning, TEXT("[BooleanProcessor] Intersection START - WorkMesh Tris=%d, DebrisTool Tris=%d"),
+				WorkMesh.TriangleCount(), DebrisTool->TriangleCount());
 
-			{
-#if !UE_BUILD_SHIPPING
-				TRACE_CPUPROFILER_EVENT_SCOPE("SlotWorkerUnion_Subtract");
-#endif
-				bSuccess = ApplyMeshBooleanAsync(
-				   &WorkMesh,
-				   &UnionResult.PendingCombinedToolMesh,
-				   &ResultMesh,
-				   EGeometryScriptBooleanOperation::Subtract,
-				   Options);
-			}
+			bool bSuccessIntersection = ApplyMeshBooleanAsync(
+				&WorkMesh,
+				DebrisTool.Get(),
+				Debris.Get(),
+				EGeometryScriptBooleanOperation::Intersection,
+				Ops);
 
-			CurrentSubtractDurationMs = (FPlatformTime::Seconds() - CurrentSubtractDurationMs) * 1000.0;
+			UE_LOG(LogTemp, Warning, TEXT("[BooleanProcessor] Intersection RESULT - bSuccess=%d, Debris Tris=%d"),
+				bSuccessIntersection ? 1 : 0, Debris->TriangleCount());
 
-			if (bSuccess)
+			if (bSuccessIntersection && Debris->TriangleCount() > 0)
 			{
-				AccumulateSubtractDuration(ChunkIndex, CurrentSubtractDurationMs);     
-				UpdateUnionSize(ChunkIndex, CurrentSubtractDurationMs);
-				// Simplify.
-				bool bEnableDetailMode = OwnerComponent->IsHighDetailMode();
+				FScopeLock Lock(&UnionResult.IslandContext->MeshLock);
+				// Initialize attributes
+				if (UnionResult.IslandContext->AccumulatedDebrisMesh.TriangleCount() == 0)
 				{
-#if !UE_BUILD_SHIPPING
-					TRACE_CPUPROFILER_EVENT_SCOPE("SlotWorkerUnion_Simplify");
-#endif
-					TrySimplify(ResultMesh, ChunkIndex, UnionResult.UnionCount, bEnableDetailMode);
+					UnionResult.IslandContext->AccumulatedDebrisMesh.EnableAttributes();
+					UnionResult.IslandContext->AccumulatedDebrisMesh.Attributes()->EnableMaterialID();
+					if (!UnionResult.IslandContext->AccumulatedDebrisMesh.HasTriangleGroups())
+					{
+						UnionResult.IslandContext->AccumulatedDebrisMesh.EnableTriangleGroups();
+					}
 				}
-			}
-			else
-			{
-				UE_LOG(LogTemp, Display, TEXT("Reset Accumulation"));
-				// Reset accumulation on failure.
-				FChunkState& State = ChunkStates.GetState(ChunkIndex);
-				State.SubtractDurationAccum = 0;
-				State.DurationAccumCount = 0;
+
+				FDynamicMeshEditor Editor(&UnionResult.IslandContext->AccumulatedDebrisMesh);
+				FMeshIndexMappings Mappings;
+				Editor.AppendMesh(Debris.Get(), Mappings);
+				bHasDebris = true;
+
+				UE_LOG(LogTemp, Warning, TEXT("[BooleanProcessor] Accumulated Debris Tris=%d"),
+					UnionResult.IslandContext->AccumulatedDebrisMesh.TriangleCount());
 			}
 		}
 		else
 		{
-			FGeometryScriptMeshBooleanOptions Ops;
-			Ops.bFillHoles = true;
-			Ops.bSimplifyOutput = false;
-
-			// Intersection (Debris): 원본 크기 DebrisToolMesh 사용
-			if (UnionResult.DebrisSharedToolMesh.IsValid() && UnionResult.IslandContext.IsValid())
-			{
-				FDynamicMesh3 DebrisTool = *UnionResult.DebrisSharedToolMesh;
-				FDynamicMesh3 Debris;
-
-				UE_LOG(LogTemp, Warning, TEXT("[BooleanProcessor] Intersection START - WorkMesh Tris=%d, DebrisTool Tris=%d"),
-					WorkMesh.TriangleCount(), DebrisTool.TriangleCount());
-
-				bool bSuccessIntersection = ApplyMeshBooleanAsync(
-					&WorkMesh,
-					&DebrisTool,
-					&Debris,
-					EGeometryScriptBooleanOperation::Intersection,
-					Ops);
-
-				UE_LOG(LogTemp, Warning, TEXT("[BooleanProcessor] Intersection RESULT - bSuccess=%d, Debris Tris=%d"),
-					bSuccessIntersection ? 1 : 0, Debris.TriangleCount());
-
-				if (bSuccessIntersection && Debris.TriangleCount() > 0)
-				{
-					FScopeLock Lock(&UnionResult.IslandContext->MeshLock);
-					// Initialize attributes
-					if (UnionResult.IslandContext->AccumulatedDebrisMesh.TriangleCount() == 0)
-					{
-						UnionResult.IslandContext->AccumulatedDebrisMesh.EnableAttributes();
-						UnionResult.IslandContext->AccumulatedDebrisMesh.Attributes()->EnableMaterialID();
-						if (!UnionResult.IslandContext->AccumulatedDebrisMesh.HasTriangleGroups())
-						{
-							UnionResult.IslandContext->AccumulatedDebrisMesh.EnableTriangleGroups();
-						}
-					}
-
-					FDynamicMeshEditor Editor(&UnionResult.IslandContext->AccumulatedDebrisMesh);
-					FMeshIndexMappings Mappings;
-					Editor.AppendMesh(&Debris, Mappings);
-					bHasDebris = true;
+			UE_LOG(LogTemp, Warning, TEXT("[BooleanProcessor] Intersection SKIPPED - DebrisToolMesh=%d, IslandContext=%d"),
+				UnionResult.DebrisSharedToolMesh.IsValid() ? 1 : 0, UnionResult.IslandContext.IsValid() ? 1 : 0);
+		}
 
-					UE_LOG(LogTemp, Warning, TEXT("[BooleanProcessor] Accumulated Debris Tris=%d"),
-						UnionResult.IslandContext->AccumulatedDebrisMesh.TriangleCount());
-				}
-			}
-			else
-			{
-				UE_LOG(LogTemp, Warning, TEXT("[BooleanProcessor] Intersection SKIPPED - DebrisToolMesh=%d, IslandContext=%d"),
-					UnionResult.DebrisSharedToolMesh.IsValid() ? 1 : 0, UnionResult.IslandContext.IsValid() ? 1 : 0);
-			}
+		// Subtract (구멍): 스케일된 SharedToolMesh 사용
+		if (UnionResult.SharedToolMesh.IsValid())
+		{
+			FMeshScratchPool::FScopedMesh LocalTool = FMeshScratchPool::AcquireCopy(*UnionResult.SharedToolMesh);
+			DamageBounds = LocalTool->GetBounds(true);
+			bSuccess = ApplyMeshBooleanAsync(
+				&WorkMesh,
+				LocalTool.Get(),
+				&ResultMesh,
+				EGeometryScriptBooleanOperation::Subtract,
+				Ops);
+		}
+	}
 
-			// Subtract (구멍): 스케일된 SharedToolMesh 사용
-			if (UnionResult.SharedToolMesh.IsValid())
-			{
-				FDynamicMesh3 LocalTool = *UnionResult.SharedToolMesh;
-				bSuccess = ApplyMeshBooleanAsync(
-					&WorkMesh,
-					&LocalTool,
-					&ResultMesh,
-					EGeometryScriptBooleanOperation::Subtract,
-					Ops);
-			}
-		} 
+	/*
+	 * Build the next snapshot here on the worker, so the game thread only swaps a pointer
+	 * and later workers read it without copying the chunk again.
+	 */
+	TSharedPtr<const FDynamicMesh3, ESPMode::ThreadSafe> PublishedMesh = nullptr;
+	if (bSuccess)
+	{
+#if !UE_BUILD_SHIPPING
+		TRACE_CPUPROFILER_EVENT_SCOPE("SlotWorkerUnion_BuildSnapshot");
+#endif
+		PublishedMesh = MakeShared<FDynamicMesh3, ESPMode::ThreadSafe>(ResultMesh);
 	}
 
 	if (SlotSubtractWorkerCounts.IsValidIndex(SlotIndex))
@@ -921,19 +917,20 @@ void FRealtimeBooleanProcessor::ProcessSlotSubtractWork(int32 SlotIndex, FUnionR
 	 SlotSubtractWorkerCounts[SlotIndex]->fetch_sub(1);
 	}
 	
-	// ===== 5. Apply results (GameThread) =====
+	// ===== 5. Apply results (GameThread, time-sliced via the completion queue) =====
 	if (bSuccess || bHasDebris)
 	{
-		AsyncTask(ENamedThreads::GameThread,
+		EnqueueCompletion(
 		          [LifeTimeToken = LifeTime,
 			          ChunkIndex,
 			          SlotIndex,
 			          ResultMesh = MoveTemp(ResultMesh),
+			          PublishedMesh = MoveTemp(PublishedMesh),
 			          Context = UnionResult.IslandContext,
 			          Decals = MoveTemp(UnionResult.Decals),
-			          UnionCount = UnionResult.UnionCount,
 			          CompletionBatchIds = MoveTemp(UnionResult.CompletionBatchIds),
-			          bSuccess]() mutable
+			          bSuccess,
+			          DamageBounds]() mutable
 		          {
 			          if (!LifeTimeToken.IsValid() || !LifeTimeToken->bAlive.load())
 			          {
@@ -961,6 +958,12 @@ void FRealtimeBooleanProcessor::ProcessSlotSubtractWork(int32 SlotIndex, FUnionR
 				          TRACE_CPUPROFILER_EVENT_SCOPE("SlotWorkerUnion_ApplyGT");
 #endif
 				          WeakOwner->ApplyBooleanOperationResult(MoveTemp(ResultMesh), ChunkIndex, true);
+
+				          // Mesh changed: bump the generation and swap in the matching snapshot.
+				          const int32 NewGeneration = Processor->ChunkGenerations[ChunkIndex].fetch_add(1) + 1;
+				          WeakOwner->PublishChunkMeshSnapshot(ChunkIndex, MoveTemp(PublishedMesh), NewGeneration);
+
+				          Processor->AddChunkDirtyRegion(ChunkIndex, DamageBounds);
 			          }
 
 			          // 배치 완료 추적: 모든 BatchId에 대해 완료 알림
@@ -1028,10 +1031,6 @@ void FRealtimeBooleanProcessor::ProcessSlotSubtractWork(int32 SlotIndex, FUnionR
 				         //  Processor->SlotSubtractWorkerCounts[SlotIndex]->fetch_sub(1);
 			          // }
 
-			          // Update counters.
-			          Processor->ChunkGenerations[ChunkIndex].fetch_add(1);
-			          Processor->ChunkHoleCount[ChunkIndex] += UnionCount;
-
 		          	WeakOwner->ClearChunkBusy(ChunkIndex);
 					UE_LOG(LogTemp, Warning, TEXT("ClearChunkBusy: ChunkIndex=%d, QueueEmpty=%d"),
 						ChunkIndex, Processor->SlotSubtractQueues[SlotIndex]->IsEmpty());
@@ -1094,11 +1093,9 @@ void FRealtimeBooleanProcessor::ProcessSlotSubtractWork(int32 SlotIndex, FUnionR
 
 void FRealtimeBooleanProcessor::CleanupSlotMapping(int32 SlotIndex)
 {
-	// Ensure union queue is empty too (both must be empty to clean up).
-	bool bUnionEmpty = SlotUnionQueues[SlotIndex]->IsEmpty();
 	bool bSubtractEmpty = SlotSubtractQueues[SlotIndex]->IsEmpty();
 
-	if (!bUnionEmpty || !bSubtractEmpty)
+	if (!bSubtractEmpty)
 	{
 		return;  // Work still remaining.
 	}
@@ -1123,7 +1120,8 @@ void FRealtimeBooleanProcessor::BooleanOpSync(FBulletHole&& Op)
 
 	FDynamicMesh3 WorkMesh = *OwnerComponent->GetMesh();
 
-	FDynamicMesh3 ToolMesh = MoveTemp(*Op.ToolMeshPtr.Get());
+	// Tool meshes may be shared templates, so transform a copy.
+	FDynamicMesh3 ToolMesh = *Op.ToolMeshPtr;
 	MeshTransforms::ApplyTransform(ToolMesh, Op.ToolTransform, true);
 
 	bool bBooleanSuccess = false;
@@ -1152,14 +1150,41 @@ void FRealtimeBooleanProcessor::BooleanOpSync(FBulletHole&& Op)
 	}
 }
 
-void FRealtimeBooleanProcessor::UpdateUnionSize(int32 ChunkIndex, double DurationMs)
+void FRealtimeBooleanProcessor::UpdateUnionSize(int32 ChunkIndex, double DurationMs, int32 ChunkTriCount, int32 ToolTriCount, int32 UnionCount)
 {
 	const int32 CurrentUnionCount = MaxUnionCount[ChunkIndex];
 	int32 NextCount = CurrentUnionCount;
-	
-	if (DurationMs > FrameBudgetMs)
+
+	bool bModelReady = false;
+	{
+		FScopeLock Lock(&CostModelLock);
+		if (ChunkCostModels.IsValidIndex(ChunkIndex))
+		{
+			FBooleanCostModel& Model = ChunkCostModels[ChunkIndex];
+			Model.AddSample(ChunkTriCount, ToolTriCount, UnionCount, DurationMs);
+
+			TRACE_COUNTER_SET(Counter_PredictedBooleanMs, Model.GetLastPredictedMs());
+			TRACE_COUNTER_SET(Counter_MeasuredBooleanMs, DurationMs);
+
+			if (Model.IsReady())
+			{
+				// Size the next batch so its predicted cost lands on the target latency.
+				NextCount = Model.SolveUnionCount(FrameBudgetMs * CostModelTargetRatio, MaxUnionCountLimit);
+				bModelReady = true;
+			}
+		}
+	}
+
+	if (bModelReady)
 	{
-		// Reduce by 70%.
+		if (NextCount != CurrentUnionCount)
+		{
+			UE_LOG(LogTemp, Verbose, TEXT("union size (model) %d to %d, measured %.2fms"), CurrentUnionCount, NextCount, DurationMs);
+		}
+	}
+	else if (DurationMs > FrameBudgetMs)
+	{
+		// Not enough samples yet: step heuristic. Reduce by 70%.
 		NextCount = FMath::FloorToInt(CurrentUnionCount * 0.7f);
 
 		/*
@@ -1175,7 +1200,7 @@ void FRealtimeBooleanProcessor::UpdateUnionSize(int32 ChunkIndex, double Duratio
 		 * 1. 20 seems sufficient.
 		 * 2. Profiling every mesh is unrealistic.
 		 */
-		NextCount = FMath::Min(CurrentUnionCount + 1, 20);
+		NextCount = FMath::Min(CurrentUnionCount + 1, MaxUnionCountLimit);
 
 		UE_LOG(LogTemp, Display, TEXT("union size increase %d to %d"), CurrentUnionCount, NextCount);
 	}
@@ -1186,145 +1211,530 @@ void FRealtimeBooleanProcessor::UpdateUnionSize(int32 ChunkIndex, double Duratio
 	}
 }
 
-void FRealtimeBooleanProcessor::KickProcessIfNeededPerChunk()
+double FRealtimeBooleanProcessor::PredictChunkBooleanCostMs(int32 ChunkIndex, int32 UnionCount) const
 {
-	/*
-	 * Build TMap by priority.
-	 * Use chunk address as key to gather per-chunk ops.
-	 */
-	TMap<UDynamicMeshComponent*, FBulletHoleBatch> HighPriorityMap;
-	TMap<UDynamicMeshComponent*, FBulletHoleBatch> NormalPriorityMap;
+	FScopeLock Lock(&CostModelLock);
+	if (!ChunkCostModels.IsValidIndex(ChunkIndex) || !ChunkCostModels[ChunkIndex].IsReady())
+	{
+		return -1.0;
+	}
 
-	/*
-	 * TMap does not preserve order.
-	 * Use arrays to preserve order.
-	 */
-	TArray<UDynamicMeshComponent*> HighPriorityOrder;
-	TArray<UDynamicMeshComponent*> NormalPriorityOrder;
+	return ChunkCostModels[ChunkIndex].PredictForUnionCount(UnionCount);
+}
 
-	
+bool FRealtimeBooleanProcessor::GetChunkCostModelSample(int32 ChunkIndex, double& OutPredictedMs, double& OutMeasuredMs) const
+{
+	FScopeLock Lock(&CostModelLock);
+	if (!ChunkCostModels.IsValidIndex(ChunkIndex) || ChunkCostModels[ChunkIndex].GetSampleCount() == 0)
+	{
+		return false;
+	}
 
-	// Pre-allocate some memory.
-	HighPriorityOrder.Reserve(100);
-	NormalPriorityOrder.Reserve(100);
+	OutPredictedMs = ChunkCostModels[ChunkIndex].GetLastPredictedMs();
+	OutMeasuredMs = ChunkCostModels[ChunkIndex].GetLastMeasuredMs();
+	return true;
+}
 
-	auto GatherOps = [&](TQueue<FBulletHole, EQueueMode::Mpsc>& Queue,
-	                     TMap<UDynamicMeshComponent*, FBulletHoleBatch>& OpMap,
-	                     TArray<UDynamicMeshComponent*>& OrderArray, int& DebugCount)
+bool FRealtimeBooleanProcessor::IsChunkOverBudget(int32 ChunkIndex) const
+{
+	const URDMSetting* Setting = URDMSetting::Get();
+	if (!Setting || !Setting->bEnableRuntimeChunkSplit)
 	{
-		// Temporary overflow array for ops beyond union limit (for re-enqueue).
-		TArray<FBulletHole> OverflowOps;
-		OverflowOps.Reserve(50);
-		
-		FBulletHole Op;
-		while (Queue.Dequeue(Op))
-		{
-			auto TargetMesh = Op.TargetMesh.Get(); 
-			if (!TargetMesh)
-			{
-				continue;
-			}
-
-			const int32 ChunkIndex = OwnerComponent->GetChunkIndex(TargetMesh);
-			if (ChunkIndex == INDEX_NONE)
-			{
-				continue;
-			}
-			
-			const int32 ChunkUnionLimit = MaxUnionCount.IsValidIndex(ChunkIndex) ? MaxUnionCount[ChunkIndex] : 10;
+		return false;
+	}
 
-			// Use Find to avoid creating unnecessary keys.
-			FBulletHoleBatch* Batch = OpMap.Find(TargetMesh);
-			const int32 CurrentCount = Batch ? Batch->Num() : 0;
+	FScopeLock Lock(&CostModelLock);
+	if (!ChunkCostModels.IsValidIndex(ChunkIndex) || ChunkCostModels[ChunkIndex].GetSampleCount() == 0)
+	{
+		return false;
+	}
 
-			// If union limit exceeded, store in overflow and re-enqueue.
-			if (CurrentCount >= ChunkUnionLimit)
-			{
-				OverflowOps.Add(MoveTemp(Op));
-			}
-			else
-			{
-				if (!Batch)
-				{
-					// Record order.
-					OrderArray.Add(TargetMesh);
+	const FBooleanCostModel& Model = ChunkCostModels[ChunkIndex];
+	if (Setting->ChunkSplitTriangleCount > 0 && Model.GetLastChunkTriCount() > Setting->ChunkSplitTriangleCount)
+	{
+		return true;
+	}
 
-					// Create map entry.
-					Batch = &OpMap.Add(TargetMesh);
-					Batch->Reserve(ChunkUnionLimit);
-				}
-				Batch->Add(MoveTemp(Op));
-				DebugCount--;
-			}
-		}
+	// Smaller batches cannot help once one tool alone no longer fits the frame.
+	return Model.IsReady() && Model.PredictForUnionCount(1) > FrameBudgetMs;
+}
 
-		for (FBulletHole& OverflowOp : OverflowOps)
+bool FRealtimeBooleanProcessor::IsChunkIdle(int32 ChunkIndex) const
+{
+	if (!ChunkStates.States.IsValidIndex(ChunkIndex) || !OwnerComponent.IsValid())
+	{
+		return false;
+	}
+
+	const FChunkState& State = ChunkStates.States[ChunkIndex];
+	if (State.bUnionInFlight || State.bSimplifyInFlight || State.bSplitInFlight)
+	{
+		return false;
+	}
+
+	if (HighPriorityPending.Buckets[ChunkIndex].Ops.Num() > 0 || NormalPriorityPending.Buckets[ChunkIndex].Ops.Num() > 0)
+	{
+		return false;
+	}
+
+	if (!ChunkUnionResultsQueues[ChunkIndex]->IsEmpty())
+	{
+		return false;
+	}
+
+	// Multi-worker: every batch launched into the task pipeline has been applied.
+	if (State.PipelineDepth > 0)
+	{
+		return false;
+	}
+
+	// Busy bit set: a subtract is running.
+	return !OwnerComponent->IsChunkBusy(ChunkIndex);
+}
+
+void FRealtimeBooleanProcessor::SetChunkSplitInFlight(int32 ChunkIndex, bool bInFlight)
+{
+	if (ChunkStates.States.IsValidIndex(ChunkIndex))
+	{
+		ChunkStates.GetState(ChunkIndex).bSplitInFlight = bInFlight;
+	}
+}
+
+void FRealtimeBooleanProcessor::OnChunkSplit(int32 ParentIndex, const TArray<int32>& ChildIndices)
+{
+	if (!ChunkStates.States.IsValidIndex(ParentIndex) || !OwnerComponent.IsValid())
+	{
+		return;
+	}
+
+	// The parent lost most of its mesh: its cost history and simplify baseline no longer apply.
+	auto ResetChunk = [this](int32 ChunkIndex)
+	{
+		FChunkState& State = ChunkStates.GetState(ChunkIndex);
+		State.Reset();
+		State.bUnionInFlight = false;
+		State.bSimplifyInFlight = false;
+		State.bSplitInFlight = false;
+		State.DirtyBounds = FAxisAlignedBox3d::Empty();
+		State.LastSimplifyTriCount = 0;
+		if (UDynamicMeshComponent* ChunkComp = OwnerComponent->GetChunkMeshComponent(ChunkIndex))
+		{
+			ChunkComp->ProcessMesh([&State](const FDynamicMesh3& ChunkMesh)
+			{
+				State.LastSimplifyTriCount = ChunkMesh.TriangleCount();
+			});
+		}
+
+		MaxInterval[ChunkIndex] = InitInterval;
+		SetMeshAvgCost[ChunkIndex] = 0.0;
+		MaxUnionCount[ChunkIndex] = 10;
+		ChunkHoleCount[ChunkIndex] = 0;
 		{
-			Queue.Enqueue(MoveTemp(OverflowOp));
+			FScopeLock Lock(&CostModelLock);
+			ChunkCostModels[ChunkIndex].Reset();
 		}
 	};
 
+	// The split replaced the meshes outside the boolean apply path: work computed from the old meshes is stale.
+	ResetChunk(ParentIndex);
+	BumpChunkGeneration(ParentIndex);
+	for (int32 ChildIndex : ChildIndices)
+	{
+		if (ChunkStates.States.IsValidIndex(ChildIndex))
+		{
+			ResetChunk(ChildIndex);
+			BumpChunkGeneration(ChildIndex);
+		}
+	}
+
+	// Requests that arrived during the split were queued for the parent; send each to the part under its tool.
+	UDynamicMeshComponent* ParentComp = OwnerComponent->GetChunkMeshComponent(ParentIndex);
+	if (!ParentComp)
+	{
+		return;
+	}
+
+	HighPriorityPending.RouteFrom(HighPriorityQueue);
+	NormalPriorityPending.RouteFrom(NormalPriorityQueue);
+
+	const FTransform ChunkToOwner = ParentComp->GetComponentTransform().GetRelativeTransform(OwnerComponent->GetComponentTransform());
+
+	auto Reroute = [&](FPendingChunkOps& Pending)
+	{
+		FChunkPendingBucket& ParentBucket = Pending.Buckets[ParentIndex];
+		const int32 OpCount = ParentBucket.Ops.Num();
+		for (int32 i = 0; i < OpCount; ++i)
+		{
+			FBulletHole Op = ParentBucket.Ops.PopFrontValue();
+			const FVector OwnerLocation = ChunkToOwner.TransformPosition(Op.ToolTransform.GetLocation());
+			const int32 TargetIndex = OwnerComponent->ResolveSplitChunk(ParentIndex, OwnerLocation);
+			if (TargetIndex == ParentIndex || !Pending.Buckets.IsValidIndex(TargetIndex))
+			{
+				ParentBucket.Ops.Add(MoveTemp(Op));
+				continue;
+			}
+
+			Op.ChunkIndex = TargetIndex;
+			Op.TargetMesh = OwnerComponent->GetChunkMeshComponent(TargetIndex);
+
+			FChunkPendingBucket& TargetBucket = Pending.Buckets[TargetIndex];
+			if (!TargetBucket.bActive)
+			{
+				TargetBucket.bActive = true;
+				Pending.ActiveChunks.Add(TargetIndex);
+			}
+			TargetBucket.Ops.Add(MoveTemp(Op));
+		}
+	};
+	Reroute(HighPriorityPending);
+	Reroute(NormalPriorityPending);
+}
+
+void FRealtimeBooleanProcessor::KickProcessIfNeededPerChunk()
+{
 	{
 #if !UE_BUILD_SHIPPING
 		TRACE_CPUPROFILER_EVENT_SCOPE("GatherOps");
 #endif
-		GatherOps(HighPriorityQueue, HighPriorityMap, HighPriorityOrder, DebugHighQueueCount);
-		GatherOps(NormalPriorityQueue, NormalPriorityMap, NormalPriorityOrder, DebugNormalQueueCount);
+		// Move newly queued requests into their chunk's bucket; each request is routed once.
+		HighPriorityPending.RouteFrom(HighPriorityQueue);
+		NormalPriorityPending.RouteFrom(NormalPriorityQueue);
 	}
 
-	auto ProcessTargetMesh = [&](TMap<UDynamicMeshComponent*, FBulletHoleBatch>& OpMap,
-	                             TQueue<FBulletHole, EQueueMode::Mpsc>& Queue,
-	                             TArray<UDynamicMeshComponent*>& OrderArray, int32& DebugCount)
+	/*
+	 * Visit only chunks that have pending requests, taking at most the chunk's union limit.
+	 * Requests that do not fit (or whose chunk is still staged) stay in the bucket untouched.
+	 */
+	auto ProcessPendingChunks = [&](FPendingChunkOps& Pending, int32& DebugCount)
 	{
-		if (OpMap.IsEmpty() || OrderArray.IsEmpty())
+		if (Pending.ActiveChunks.IsEmpty())
 		{
 			return;
 		}
 
-		for (auto TargetMesh : OrderArray)
+		TArray<int32> ActiveChunks = MoveTemp(Pending.ActiveChunks);
+		Pending.ActiveChunks.Reset();
+
+		for (const int32 ChunkIndex : ActiveChunks)
 		{
-			const int32 ChunkIndex = OwnerComponent->GetChunkIndex(TargetMesh);
+			FChunkPendingBucket& Bucket = Pending.Buckets[ChunkIndex];
+
+			// The chunk is being split: its requests are re-routed to the parts once it lands.
+			if (ChunkStates.GetState(ChunkIndex).bSplitInFlight)
+			{
+				Pending.ActiveChunks.Add(ChunkIndex);
+				continue;
+			}
+
+			if (bEnableMultiWorkers && !CanExtendChunkPipeline(ChunkIndex))
+			{
+				// Pipeline full, or the chunk is held by other work: the requests wait in the bucket.
+				Pending.ActiveChunks.Add(ChunkIndex);
+				continue;
+			}
+
+			if (!bEnableMultiWorkers)
+			{
+				/*
+				 * Two-stage pipeline per chunk: while subtract(N) holds the chunk busy bit,
+				 * union(N+1) may run on another worker. At most one batch is staged ahead,
+				 * and staged batches always subtract before newer ones, keeping per-chunk order.
+				 */
+				TryStartStagedSubtract(ChunkIndex);
+
+				const bool bHasStagedWork = ChunkStates.GetState(ChunkIndex).bUnionInFlight ||
+					!ChunkUnionResultsQueues[ChunkIndex]->IsEmpty();
+				if (bHasStagedWork)
+				{
+					// Leave the requests in the bucket until the staged batch has subtracted.
+					Pending.ActiveChunks.Add(ChunkIndex);
+					continue;
+				}
+			}
+
+			const int32 ChunkUnionLimit = MaxUnionCount.IsValidIndex(ChunkIndex) ? MaxUnionCount[ChunkIndex] : 10;
+			FBulletHoleBatch Batch;
+			Batch.Reserve(FMath::Min(ChunkUnionLimit, Bucket.Ops.Num()));
+			Batch.ChunkIndex = ChunkIndex;
+			Batch.WorkEpoch = ChunkWorkEpochs[ChunkIndex].load();
+
+			FBulletHole Op;
+			while (Batch.Num() < ChunkUnionLimit && !Bucket.Ops.IsEmpty())
+			{
+				Op = Bucket.Ops.PopFrontValue();
+				DebugCount--;
+
+				// Chunk component went away after the request was queued.
+				if (!Op.TargetMesh.IsValid())
+				{
+					continue;
+				}
+				Batch.Add(MoveTemp(Op));
+			}
+
+			if (Bucket.Ops.IsEmpty())
+			{
+				Bucket.bActive = false;
+			}
+			else
+			{
+				Pending.ActiveChunks.Add(ChunkIndex);
+			}
+
+			// Tools that cannot touch the chunk never reach a worker.
+			CullToolsOutsideChunk(Batch);
 
-			if (ChunkIndex == INDEX_NONE)
+			if (Batch.Num() == 0)
 			{
+				// Nothing left to cut: the requests are done as far as batch tracking is concerned.
+				for (int32 BatchId : Batch.CompletionBatchIds)
+				{
+					OwnerComponent->NotifyBooleanCompleted(BatchId);
+				}
 				continue;
 			}
 
-			if (FBulletHoleBatch* Batch = OpMap.Find(TargetMesh))
-			{
-				Batch->ChunkIndex = ChunkIndex;
-				UE_LOG(LogTemp, Display, TEXT("ToolMeshTri/lamda %d/ %d"), Batch->Num(), Batch->ToolMeshPtrs[0].Get()->TriangleCount());
-				 if (bEnableMultiWorkers)
-				 {
-				 	// Decide slot for this chunk.
-				 	int32 TargetSlot = FindLeastBusySlot();
-				 	
-				 	// Enqueue into union queue.
-				  	SlotUnionQueues[TargetSlot]->Enqueue(MoveTemp(*Batch));
-				 	// Wake union worker.
-				 	KickUnionWorker(TargetSlot);
-				 }
-				 else
-				 {
-				 	if (!OwnerComponent->CheckAndSetChunkBusy(ChunkIndex))
-				 	{
-				 		const int32 Gen = ChunkGenerations[ChunkIndex];
-				 		StartBooleanWorkerAsyncForChunk(MoveTemp(*Batch), Gen);
-				 	}
-				 	else
-				 	{
-				 		/*
-				 			* Add logic to re-queue batches for busy chunks.
-				 			*/
-				 		EnqueueRetryOps(Queue, MoveTemp(*Batch), TargetMesh, ChunkIndex, DebugCount);
-				 	}
-				 }
+			UE_LOG(LogTemp, Display, TEXT("ToolMeshTri/lamda %d/ %d"), Batch.Num(), Batch.ToolMeshPtrs[0].Get()->TriangleCount());
+			if (bEnableMultiWorkers)
+			{
+				LaunchChunkPipeline(MoveTemp(Batch));
+			}
+			else if (!OwnerComponent->CheckAndSetChunkBusy(ChunkIndex))
+			{
+				const int32 Gen = ChunkGenerations[ChunkIndex];
+				StartBooleanWorkerAsyncForChunk(MoveTemp(Batch), Gen);
+			}
+			else
+			{
+				// Chunk is subtracting: union the next batch now instead of waiting.
+				StartUnionStageForChunk(MoveTemp(Batch));
 			}
 		}
 	};
 
-	ProcessTargetMesh(HighPriorityMap, HighPriorityQueue, HighPriorityOrder, DebugHighQueueCount);
-	ProcessTargetMesh(NormalPriorityMap, NormalPriorityQueue, NormalPriorityOrder, DebugNormalQueueCount);
+	ProcessPendingChunks(HighPriorityPending, DebugHighQueueCount);
+	ProcessPendingChunks(NormalPriorityPending, DebugNormalQueueCount);
+}
+
+int32 FRealtimeBooleanProcessor::CullToolsOutsideChunk(FBulletHoleBatch& Batch) const
+{
+#if !UE_BUILD_SHIPPING
+	TRACE_CPUPROFILER_EVENT_SCOPE("CullToolsOutsideChunk");
+#endif
+	const int32 ToolCount = Batch.Num();
+	UDynamicMeshComponent* ChunkComponent = OwnerComponent.IsValid() ? OwnerComponent->GetChunkMeshComponent(Batch.ChunkIndex) : nullptr;
+	if (ToolCount == 0 || !ChunkComponent)
+	{
+		return 0;
+	}
+
+	// Component bounds are cached by the engine; bring them into chunk space (tool transforms live there).
+	const FTransform& ChunkToWorld = ChunkComponent->GetComponentTransform();
+	const FBox ChunkBounds = ChunkComponent->Bounds.GetBox().InverseTransformBy(ChunkToWorld);
+
+	// Grid cells are laid out in the owner's local space.
+	const FGridCellLayout& Layout = OwnerComponent->GetGridCellLayout();
+	const bool bUseCells = Layout.IsValid();
+	const FTransform ChunkToOwner = ChunkToWorld.GetRelativeTransform(OwnerComponent->GetComponentTransform());
+
+	// Only a handful of distinct templates per batch; bounds are computed once each.
+	TMap<const FDynamicMesh3*, FBox> TemplateBounds;
+
+	TBitArray<> Keep(true, ToolCount);
+	int32 CulledCount = 0;
+	for (int32 i = 0; i < ToolCount; ++i)
+	{
+		const FDynamicMesh3* ToolMesh = Batch.ToolMeshPtrs[i].Get();
+		if (!ToolMesh)
+		{
+			continue;
+		}
+
+		FBox* LocalBounds = TemplateBounds.Find(ToolMesh);
+		if (!LocalBounds)
+		{
+			LocalBounds = &TemplateBounds.Add(ToolMesh, static_cast<FBox>(ToolMesh->GetBounds(true)));
+		}
+
+		const FBox ToolBounds = LocalBounds->TransformBy(Batch.ToolTransforms[i]);
+		bool bCull = ChunkBounds.IsValid && !ChunkBounds.Intersect(ToolBounds);
+
+		// Inside the chunk bounds but only over empty grid space (no source geometry there).
+		if (!bCull && bUseCells)
+		{
+			const FBox CellBounds = ToolBounds.TransformBy(ChunkToOwner);
+			const FIntVector MinCoord(
+				FMath::FloorToInt((CellBounds.Min.X - Layout.GridOrigin.X) / Layout.CellSize.X),
+				FMath::FloorToInt((CellBounds.Min.Y - Layout.GridOrigin.Y) / Layout.CellSize.Y),
+				FMath::FloorToInt((CellBounds.Min.Z - Layout.GridOrigin.Z) / Layout.CellSize.Z));
+			const FIntVector MaxCoord(
+				FMath::FloorToInt((CellBounds.Max.X - Layout.GridOrigin.X) / Layout.CellSize.X),
+				FMath::FloorToInt((CellBounds.Max.Y - Layout.GridOrigin.Y) / Layout.CellSize.Y),
+				FMath::FloorToInt((CellBounds.Max.Z - Layout.GridOrigin.Z) / Layout.CellSize.Z));
+			const FIntVector Span = MaxCoord - MinCoord + FIntVector(1);
+
+			if (Span.X * Span.Y * Span.Z <= MaxCullCellsPerTool)
+			{
+				bool bAnyGeometry = false;
+				for (int32 Z = MinCoord.Z; Z <= MaxCoord.Z && !bAnyGeometry; ++Z)
+				{
+					for (int32 Y = MinCoord.Y; Y <= MaxCoord.Y && !bAnyGeometry; ++Y)
+					{
+						for (int32 X = MinCoord.X; X <= MaxCoord.X && !bAnyGeometry; ++X)
+						{
+							bAnyGeometry = Layout.IsValidCoord(X, Y, Z) && Layout.GetCellExists(Layout.CoordToId(X, Y, Z));
+						}
+					}
+				}
+				bCull = !bAnyGeometry;
+			}
+		}
+
+		if (bCull)
+		{
+			Keep[i] = false;
+			++CulledCount;
+		}
+	}
+
+	if (CulledCount > 0)
+	{
+		Batch.KeepOnly(Keep);
+		const int64 Total = CulledToolCount.fetch_add(CulledCount, std::memory_order_relaxed) + CulledCount;
+		TRACE_COUNTER_SET(Counter_CulledTools, Total);
+		UE_LOG(LogTemp, Verbose, TEXT("[CullTools] Chunk %d: dropped %d of %d tools outside the chunk"),
+			Batch.ChunkIndex, CulledCount, ToolCount);
+	}
+
+	return CulledCount;
+}
+
+int32 FRealtimeBooleanProcessor::CoalesceBatchTools(FBulletHoleBatch& Batch)
+{
+	const int32 ToolCount = Batch.Num();
+	if (ToolCount < 2)
+	{
+		return 0;
+	}
+
+#if !UE_BUILD_SHIPPING
+	TRACE_CPUPROFILER_EVENT_SCOPE("CoalesceBatchTools");
+#endif
+
+	struct FTemplateShape
+	{
+		FVector3d Center = FVector3d::Zero();
+		/** Radius of the ball around Center that encloses the template. */
+		double OuterRadius = 0.0;
+		/** Radius of a ball around Center that lies inside the template; 0 if none was proven. */
+		double InnerRadius = 0.0;
+	};
+
+	// Templates are convex primitives; prove it per template instead of assuming it.
+	auto BuildShape = [](const FDynamicMesh3& Mesh)
+	{
+		FTemplateShape Shape;
+		const FAxisAlignedBox3d Bounds = Mesh.GetBounds(true);
+		Shape.Center = Bounds.Center();
+		Shape.OuterRadius = Bounds.Extents().Length();
+
+		double MinPlaneDistance = TNumericLimits<double>::Max();
+		for (int32 TriangleID : Mesh.TriangleIndicesItr())
+		{
+			const FVector3d Normal = Mesh.GetTriNormal(TriangleID);
+			const FVector3d Vertex = Mesh.GetVertex(Mesh.GetTriangle(TriangleID).A);
+
+			// Center must be behind every face; then the ball up to the nearest face plane is inside.
+			const double Distance = Normal.Dot(Vertex - Shape.Center);
+			if (Distance <= 0.0)
+			{
+				return Shape;
+			}
+			MinPlaneDistance = FMath::Min(MinPlaneDistance, Distance);
+		}
+
+		Shape.InnerRadius = Mesh.TriangleCount() > 0 ? MinPlaneDistance : 0.0;
+		return Shape;
+	};
+
+	TMap<const FDynamicMesh3*, FTemplateShape> Shapes;
+
+	struct FToolBall
+	{
+		FVector3d Center;
+		double OuterRadius;
+		double InnerRadius;
+	};
+	TArray<FToolBall> Balls;
+	Balls.SetNumUninitialized(ToolCount);
+
+	for (int32 i = 0; i < ToolCount; ++i)
+	{
+		const FDynamicMesh3* ToolMesh = Batch.ToolMeshPtrs[i].Get();
+		if (!ToolMesh)
+		{
+			Balls[i] = {FVector3d::Zero(), 0.0, 0.0};
+			continue;
+		}
+
+		const FTemplateShape* Shape = Shapes.Find(ToolMesh);
+		if (!Shape)
+		{
+			Shape = &Shapes.Add(ToolMesh, BuildShape(*ToolMesh));
+		}
+
+		const FTransform& Transform = Batch.ToolTransforms[i];
+		const FVector AbsScale = Transform.GetScale3D().GetAbs();
+		Balls[i].Center = Transform.TransformPosition(Shape->Center);
+		Balls[i].OuterRadius = Shape->OuterRadius * AbsScale.GetMax();
+		Balls[i].InnerRadius = Shape->InnerRadius * AbsScale.GetMin();
+	}
+
+	TBitArray<> Keep(true, ToolCount);
+	int32 DroppedCount = 0;
+	for (int32 i = 0; i < ToolCount; ++i)
+	{
+		if (!Batch.ToolMeshPtrs[i].IsValid())
+		{
+			continue;
+		}
+
+		for (int32 j = 0; j < ToolCount; ++j)
+		{
+			if (j == i || !Keep[j] || !Batch.ToolMeshPtrs[j].IsValid())
+			{
+				continue;
+			}
+
+			const double CenterDistance = FVector3d::Distance(Balls[i].Center, Balls[j].Center);
+
+			// Repeat of an earlier tool: same template, same place, same orientation and scale.
+			const bool bDuplicate = j < i &&
+				Batch.ToolMeshPtrs[i] == Batch.ToolMeshPtrs[j] &&
+				CenterDistance <= Balls[j].OuterRadius * DuplicateToolDistanceRatio &&
+				Batch.ToolTransforms[i].GetRotation().Equals(Batch.ToolTransforms[j].GetRotation(), 1.e-3) &&
+				Batch.ToolTransforms[i].GetScale3D().Equals(Batch.ToolTransforms[j].GetScale3D(), 1.e-3);
+
+			// Whole tool i lies inside the inscribed ball of tool j.
+			const bool bContained = CenterDistance + Balls[i].OuterRadius <= Balls[j].InnerRadius;
+
+			if (bDuplicate || bContained)
+			{
+				Keep[i] = false;
+				++DroppedCount;
+				break;
+			}
+		}
+	}
+
+	if (DroppedCount > 0)
+	{
+		Batch.KeepOnly(Keep);
+		const int64 Total = CulledToolCount.fetch_add(DroppedCount, std::memory_order_relaxed) + DroppedCount;
+		TRACE_COUNTER_SET(Counter_CulledTools, Total);
+	}
+
+	return DroppedCount;
 }
 
 void FRealtimeBooleanProcessor::StartBooleanWorkerAsyncForChunk(FBulletHoleBatch&& InBatch, int32 Gen)
@@ -1334,28 +1744,14 @@ void FRealtimeBooleanProcessor::StartBooleanWorkerAsyncForChunk(FBulletHoleBatch
 		return;
 	}
 
+	const int32 BatchID = ChunkNextBatchIDs[InBatch.ChunkIndex].fetch_add(1);
+
 	FGeometryScriptMeshBooleanOptions Options = OwnerComponent->GetBooleanOptions();
 	UE::Tasks::Launch(
 		UE_SOURCE_LOCATION,
 		[OwnerComponent = OwnerComponent, LifeTimeToken = LifeTime,
-		Batch = MoveTemp(InBatch), Options, Gen]() mutable
+		Batch = MoveTemp(InBatch), Options, BatchID]() mutable
 		{
-			// Safely clear the busy bit.
-			auto SafeClearBusyBit = [&]()
-				{
-					if (OwnerComponent.IsValid())
-					{
-						int32 IndexToClear = Batch.ChunkIndex;
-						AsyncTask(ENamedThreads::GameThread, [OwnerComponent, IndexToClear]()
-							{
-								if (OwnerComponent.IsValid())
-								{
-									OwnerComponent->ClearChunkBusy(IndexToClear);
-								}
-							});
-					}
-				};
-
 			if (!OwnerComponent.IsValid())
 			{
 				return;
@@ -1367,234 +1763,575 @@ void FRealtimeBooleanProcessor::StartBooleanWorkerAsyncForChunk(FBulletHoleBatch
 			TSharedPtr<FRealtimeBooleanProcessor, ESPMode::ThreadSafe> Processor = LifeTimeToken->Processor.Pin();
 			if (!Processor.IsValid())
 			{
-				SafeClearBusyBit();
+				const int32 IndexToClear = Batch.ChunkIndex;
+				AsyncTask(ENamedThreads::GameThread, [OwnerComponent, IndexToClear]()
+					{
+						if (OwnerComponent.IsValid())
+						{
+							OwnerComponent->ClearChunkBusy(IndexToClear);
+						}
+					});
 				return;
 			}
 
-			const int32 BatchCount = Batch.Num();
-			if (BatchCount <= 0)
+			// Chunk was idle: union and subtract back to back on this worker.
+			FUnionResult UnionResult;
+			UnionResult.BatchID = BatchID;
 			{
-				SafeClearBusyBit();
-				return;
+#if !UE_BUILD_SHIPPING
+				TRACE_CPUPROFILER_EVENT_SCOPE("ChunkBooleanAsync_Union");
+#endif
+				Processor->BuildChunkUnionResult(MoveTemp(Batch), UnionResult);
 			}
 
-			const int32 ChunkIndex = Batch.ChunkIndex;
-			// Copy target mesh.
-			FDynamicMesh3 WorkMesh;
-			if (!OwnerComponent->GetChunkMesh(WorkMesh, ChunkIndex))
+			Processor->RunChunkSubtractStage(MoveTemp(UnionResult), Options);
+		});
+}
+
+void FRealtimeBooleanProcessor::StartUnionStageForChunk(FBulletHoleBatch&& InBatch)
+{
+	const int32 ChunkIndex = InBatch.ChunkIndex;
+	if (InBatch.Num() == 0 || !ChunkStates.States.IsValidIndex(ChunkIndex))
+	{
+		return;
+	}
+
+	ChunkStates.GetState(ChunkIndex).bUnionInFlight = true;
+	const int32 BatchID = ChunkNextBatchIDs[ChunkIndex].fetch_add(1);
+
+	UE::Tasks::Launch(
+		UE_SOURCE_LOCATION,
+		[LifeTimeToken = LifeTime, Batch = MoveTemp(InBatch), BatchID]() mutable
+		{
+			TSharedPtr<FRealtimeBooleanProcessor, ESPMode::ThreadSafe> WorkerProcessor =
+				LifeTimeToken.IsValid() ? LifeTimeToken->Processor.Pin() : nullptr;
+			if (!WorkerProcessor.IsValid())
 			{
-				SafeClearBusyBit();
 				return;
 			}
 
-			using namespace UE::Geometry;
-
-			int32 AppliedCount = 0;
-			TArray<TWeakObjectPtr<UDecalComponent>> DecalsToRemove;
-			DecalsToRemove.Reserve(BatchCount);
-			// 배치 완료 추적용 ID 배열 (다른 데이터 move 전에 먼저 추출)
-			TArray<int32> CompletionBatchIds = MoveTemp(Batch.CompletionBatchIds);
-			TArray<TWeakObjectPtr<UDecalComponent>> TemporaryDecals = MoveTemp(Batch.TemporaryDecals);
-			TArray<FTransform> Transforms = MoveTemp(Batch.ToolTransforms);
-			TArray<TSharedPtr<UE::Geometry::FDynamicMesh3, ESPMode::ThreadSafe>> ToolMeshPtrs = MoveTemp(Batch.ToolMeshPtrs);
-
-			int32 UnionCount = 0;
-			bool bIsFirst = true;
-			bool bCombinedValid = false;
-			FDynamicMesh3 CombinedToolMesh;
+			// Tool meshes only: runs while the previous batch of this chunk is still subtracting.
+			FUnionResult UnionResult;
+			UnionResult.BatchID = BatchID;
 			{
 #if !UE_BUILD_SHIPPING
-				TRACE_CPUPROFILER_EVENT_SCOPE("ChunkBooleanAsync_Union");
+				TRACE_CPUPROFILER_EVENT_SCOPE("ChunkBooleanAsync_UnionStage");
 #endif
-				for (int32 i = 0; i < BatchCount; i++)
+				WorkerProcessor->BuildChunkUnionResult(MoveTemp(Batch), UnionResult);
+			}
+
+			AsyncTask(ENamedThreads::GameThread, [LifeTimeToken, UnionResult = MoveTemp(UnionResult)]() mutable
+			{
+				if (!LifeTimeToken.IsValid() || !LifeTimeToken->bAlive.load())
 				{
+					return;
+				}
 
-					if (!ToolMeshPtrs[i].IsValid())
-					{
-						SafeClearBusyBit();
-						return;
-					}
+				if (TSharedPtr<FRealtimeBooleanProcessor, ESPMode::ThreadSafe> Processor = LifeTimeToken->Processor.Pin())
+				{
+					Processor->OnUnionStageCompleted(MoveTemp(UnionResult));
+				}
+			});
+		});
+}
 
-					FTransform ToolTransform = MoveTemp(Transforms[i]);
-					TWeakObjectPtr<UDecalComponent> TemporaryDecal = MoveTemp(TemporaryDecals[i]);
+void FRealtimeBooleanProcessor::OnUnionStageCompleted(FUnionResult&& UnionResult)
+{
+	const int32 ChunkIndex = UnionResult.ChunkIndex;
+	if (!ChunkStates.States.IsValidIndex(ChunkIndex) || !ChunkUnionResultsQueues.IsValidIndex(ChunkIndex))
+	{
+		return;
+	}
 
-					FDynamicMesh3 CurrentTool = *(ToolMeshPtrs[i]);
-					MeshTransforms::ApplyTransform(CurrentTool, (FTransformSRT3d)ToolTransform, true);
+	ChunkStates.GetState(ChunkIndex).bUnionInFlight = false;
+	ChunkUnionResultsQueues[ChunkIndex]->Enqueue(MoveTemp(UnionResult));
 
-					if (TemporaryDecal.IsValid())
-					{
-						DecalsToRemove.Add(MoveTemp(TemporaryDecal));
-					}
+	TryStartStagedSubtract(ChunkIndex);
+}
 
-					if (bIsFirst)
-					{
-						bIsFirst = false;
-						CombinedToolMesh = CurrentTool;
-						bCombinedValid = true;
-						UnionCount++;
-					}
-					else
+void FRealtimeBooleanProcessor::TryStartStagedSubtract(int32 ChunkIndex)
+{
+	if (!OwnerComponent.IsValid() || !ChunkUnionResultsQueues.IsValidIndex(ChunkIndex) ||
+		ChunkUnionResultsQueues[ChunkIndex]->IsEmpty())
+	{
+		return;
+	}
+
+	// Previous subtract still running; its completion calls back here.
+	if (OwnerComponent->CheckAndSetChunkBusy(ChunkIndex))
+	{
+		return;
+	}
+
+	FUnionResult UnionResult;
+	ChunkUnionResultsQueues[ChunkIndex]->Dequeue(UnionResult);
+
+	UE_LOG(LogTemp, Verbose, TEXT("[ChunkPipeline] Chunk %d subtract stage started for BatchID %d"), ChunkIndex, UnionResult.BatchID);
+
+	FGeometryScriptMeshBooleanOptions Options = OwnerComponent->GetBooleanOptions();
+	UE::Tasks::Launch(
+		UE_SOURCE_LOCATION,
+		[OwnerComponent = OwnerComponent, LifeTimeToken = LifeTime, UnionResult = MoveTemp(UnionResult), Options]() mutable
+		{
+			TSharedPtr<FRealtimeBooleanProcessor, ESPMode::ThreadSafe> Processor =
+				LifeTimeToken.IsValid() ? LifeTimeToken->Processor.Pin() : nullptr;
+			if (!Processor.IsValid())
+			{
+				const int32 IndexToClear = UnionResult.ChunkIndex;
+				AsyncTask(ENamedThreads::GameThread, [OwnerComponent, IndexToClear]()
 					{
-						FDynamicMesh3 UnionResult;
-						FMeshBoolean MeshUnion(&CombinedToolMesh, FTransform::Identity,
-							&CurrentTool, FTransform::Identity,
-							&UnionResult, FMeshBoolean::EBooleanOp::Union);
-						if (MeshUnion.Compute())
+						if (OwnerComponent.IsValid())
 						{
-							CombinedToolMesh = MoveTemp(UnionResult);
-							UnionCount++;
+							OwnerComponent->ClearChunkBusy(IndexToClear);
 						}
-					}
-				}
+					});
+				return;
 			}
-						
-			bool bSubtractSuccess = false;
-			if (bCombinedValid && CombinedToolMesh.TriangleCount() > 0)
+
+			Processor->RunChunkSubtractStage(MoveTemp(UnionResult), Options);
+		});
+}
+
+bool FRealtimeBooleanProcessor::CanExtendChunkPipeline(int32 ChunkIndex) const
+{
+	if (!OwnerComponent.IsValid() || !ChunkStates.States.IsValidIndex(ChunkIndex) || !GetThreadManager())
+	{
+		return false;
+	}
+
+	const FChunkState& State = ChunkStates.States[ChunkIndex];
+	if (State.PipelineDepth >= MaxChunkPipelineDepth)
+	{
+		return false;
+	}
+
+	// Entering an idle chunk takes its busy bit, so wait while an island removal holds it.
+	return State.PipelineDepth > 0 || !OwnerComponent->IsChunkBusy(ChunkIndex);
+}
+
+void FRealtimeBooleanProcessor::LaunchChunkPipeline(FBulletHoleBatch&& Batch)
+{
+	const int32 ChunkIndex = Batch.ChunkIndex;
+	URDMThreadManagerSubsystem* ThreadManager = GetThreadManager();
+	if (!ThreadManager || !OwnerComponent.IsValid() || !ChunkStates.States.IsValidIndex(ChunkIndex))
+	{
+		return;
+	}
+
+	FChunkState& State = ChunkStates.GetState(ChunkIndex);
+	if (State.PipelineDepth == 0)
+	{
+		// Held until the last batch in flight is applied; island removal and splits wait for it.
+		OwnerComponent->CheckAndSetChunkBusy(ChunkIndex);
+	}
+	++State.PipelineDepth;
+
+	// Union -> subtract hand-off; written by the union task, consumed by the subtract task.
+	TSharedRef<FUnionResult, ESPMode::ThreadSafe> Stage = MakeShared<FUnionResult, ESPMode::ThreadSafe>();
+	TSharedPtr<FRDMTaskSignal, ESPMode::ThreadSafe> Applied = MakeShared<FRDMTaskSignal, ESPMode::ThreadSafe>();
+
+	const ERDMWorkPriority Priority = GetWorkPriority();
+	const FGeometryScriptMeshBooleanOptions Options = OwnerComponent->GetBooleanOptions();
+	TSharedPtr<FProcessorLifeTime, ESPMode::ThreadSafe> LifeTimeToken = LifeTime;
+
+	// Tool meshes only, so it may overlap the subtract of the chunk's previous batch.
+	const UE::Tasks::FTask UnionTask = ThreadManager->RequestTask(
+		[LifeTimeToken, Stage, Batch = MoveTemp(Batch)]() mutable
+		{
+			if (!LifeTimeToken.IsValid() || !LifeTimeToken->bAlive.load())
 			{
-				double CurrentSubDuration = FPlatformTime::Seconds();
+				return;
+			}
+			if (auto Processor = LifeTimeToken->Processor.Pin())
+			{
+#if !UE_BUILD_SHIPPING
+				TRACE_CPUPROFILER_EVENT_SCOPE("ChunkPipeline_Union");
+#endif
+				Processor->BuildChunkUnionResult(MoveTemp(Batch), *Stage);
+			}
+		},
+		OwnerComponent.Get(), ERDMWorkClass::Union, Priority);
 
-				FDynamicMesh3 ResultMesh;
-				{
+	// Starts straight from the union's worker once the previous batch was applied, so it reads the latest snapshot.
+	ThreadManager->RequestTask(
+		[LifeTimeToken, Stage, Applied, Options]() mutable
+		{
+			if (!LifeTimeToken.IsValid() || !LifeTimeToken->bAlive.load())
+			{
+				return;
+			}
+			if (auto Processor = LifeTimeToken->Processor.Pin())
+			{
+				Processor->RunChunkSubtractStage(MoveTemp(*Stage), Options, MoveTemp(Applied));
+			}
+		},
+		OwnerComponent.Get(), ERDMWorkClass::Subtract, Priority, { UnionTask, State.PipelineTail });
+
+	State.PipelineTail = Applied->GetTask();
+}
+
+void FRealtimeBooleanProcessor::ReleaseChunkPipelineBatch(int32 ChunkIndex)
+{
+	if (!ChunkStates.States.IsValidIndex(ChunkIndex))
+	{
+		return;
+	}
+
+	FChunkState& State = ChunkStates.GetState(ChunkIndex);
+	State.PipelineDepth = FMath::Max(0, State.PipelineDepth - 1);
+	if (State.PipelineDepth > 0)
+	{
+		return;
+	}
+
+	State.PipelineTail = UE::Tasks::FTask();
+	if (OwnerComponent.IsValid())
+	{
+		OwnerComponent->ClearChunkBusy(ChunkIndex);
+	}
+
+	// Island removals that waited for the chunk can run now.
+	for (int32 i = 0; i < SlotSubtractQueues.Num(); i++)
+	{
+		if (!SlotSubtractQueues[i]->IsEmpty())
+		{
+			KickSubtractWorker(i);
+		}
+	}
+}
+
+bool FRealtimeBooleanProcessor::BuildChunkUnionResult(FBulletHoleBatch&& Batch, FUnionResult& OutResult)
+{
+	CoalesceBatchTools(Batch);
+
+	const int32 BatchCount = Batch.Num();
+	const int32 ChunkIndex = Batch.ChunkIndex;
+
+	const double UnionStartTime = FPlatformTime::Seconds();
+	OutResult.ChunkIndex = ChunkIndex;
+	OutResult.WorkEpoch = Batch.WorkEpoch;
+	// 배치 완료 추적용 ID 배열 (다른 데이터 move 전에 먼저 추출)
+	OutResult.CompletionBatchIds = MoveTemp(Batch.CompletionBatchIds);
+
+	TArray<TWeakObjectPtr<UDecalComponent>> TemporaryDecals = MoveTemp(Batch.TemporaryDecals);
+	TArray<FTransform> Transforms = MoveTemp(Batch.ToolTransforms);
+	TArray<TSharedPtr<const FDynamicMesh3, ESPMode::ThreadSafe>> ToolMeshPtrs = MoveTemp(Batch.ToolMeshPtrs);
+
+	TArray<FMeshScratchPool::FScopedMesh> ToolMeshes;
+	ToolMeshes.Reserve(BatchCount);
+	for (int32 i = 0; i < BatchCount; i++)
+	{
+		if (!ToolMeshPtrs[i].IsValid() || ToolMeshPtrs[i]->TriangleCount() == 0)
+		{
+			continue;
+		}
+
+		FDynamicMesh3& CurrentTool = *ToolMeshes.Add_GetRef(FMeshScratchPool::AcquireCopy(*ToolMeshPtrs[i]));
+		MeshTransforms::ApplyTransform(CurrentTool, (FTransformSRT3d)Transforms[i], true);
+
+		if (TemporaryDecals[i].IsValid())
+		{
+			OutResult.Decals.Add(MoveTemp(TemporaryDecals[i]));
+		}
+	}
+
+	OutResult.UnionCount = UnionToolMeshesTree(MoveTemp(ToolMeshes), OutResult.PendingCombinedToolMesh, ChunkIndex, OutResult.WorkEpoch);
+	OutResult.SpentMs = (FPlatformTime::Seconds() - UnionStartTime) * 1000.0;
+	return OutResult.UnionCount > 0 && OutResult.PendingCombinedToolMesh.TriangleCount() > 0;
+}
+
+void FRealtimeBooleanProcessor::RunChunkSubtractStage(FUnionResult&& UnionResult, const FGeometryScriptMeshBooleanOptions& Options,
+	TSharedPtr<FRDMTaskSignal, ESPMode::ThreadSafe> AppliedSignal)
+{
+	const int32 ChunkIndex = UnionResult.ChunkIndex;
+	const int32 UnionCount = UnionResult.UnionCount;
+
+	// Boolean result to apply on the GameThread.
+	FDynamicMesh3 WorkMesh;
+	TSharedPtr<const FDynamicMesh3, ESPMode::ThreadSafe> PublishedMesh = nullptr;
+	int32 AppliedCount = 0;
+	bool bSimplifyDue = false;
+	bool bEnableDetailMode = false;
+	FAxisAlignedBox3d DamageBounds = FAxisAlignedBox3d::Empty();
+
+	// Shared read-only snapshot of the target mesh (no deep copy).
+	// Taken only now, after the previous result of this chunk was applied, so it is the latest generation.
+	FChunkMeshSnapshot ChunkSnapshot;
+	const bool bHasSnapshot = OwnerComponent.IsValid() && OwnerComponent->AcquireChunkMeshSnapshot(ChunkIndex, ChunkSnapshot);
+
+	// Chunk was superseded after the union: skip the subtract, the completion still releases the chunk.
+	const bool bStale = IsChunkWorkStale(ChunkIndex, UnionResult.WorkEpoch);
+	if (bStale)
+	{
+		AddWastedBooleanMs(UnionResult.SpentMs);
+	}
+
+	if (!bStale && bHasSnapshot && UnionCount > 0 && UnionResult.PendingCombinedToolMesh.TriangleCount() > 0)
+	{
+		const FDynamicMesh3& TargetMesh = *ChunkSnapshot.Mesh;
+		double CurrentSubDuration = FPlatformTime::Seconds();
+
+		FDynamicMesh3 ResultMesh;
+		bool bSubtractSuccess = false;
+		{
 #if !UE_BUILD_SHIPPING
-					TRACE_CPUPROFILER_EVENT_SCOPE("ChunkBooleanAsync_Subtract");
+			TRACE_CPUPROFILER_EVENT_SCOPE("ChunkBooleanAsync_Subtract");
 #endif
-					if (CombinedToolMesh.TriangleCount() > 0)
-					{
-						FAxisAlignedBox3d ToolBounds = CombinedToolMesh.GetBounds();
-						FAxisAlignedBox3d TargetBounds = WorkMesh.GetBounds();
-
-						// Target mesh info (commented out to avoid log spam).
-						// UE_LOG(LogTemp, Warning, TEXT("[Boolean Debug] CombinedToolMesh Center: %s, Size: %s"),
-						// 	*FVector(ToolBounds.Center()).ToString(),
-						// 	*FVector(ToolBounds.Extents()).ToString());
-						//
-						// UE_LOG(LogTemp, Warning, TEXT("[Boolean Debug] WorkMesh(Target) Center: %s, Size: %s"),
-						// 	*FVector(TargetBounds.Center()).ToString(),
-						// 	*FVector(TargetBounds.Extents()).ToString());
-					}
+			bSubtractSuccess = SubtractFromChunkMesh(TargetMesh, UnionResult.PendingCombinedToolMesh, ResultMesh, Options);
+		}
 
-					bSubtractSuccess = ApplyMeshBooleanAsync(&WorkMesh, &CombinedToolMesh, &ResultMesh,
-					                                         EGeometryScriptBooleanOperation::Subtract, Options);
-				}
-				// Re-check processor validity (may be destroyed during async).
-				if (!Processor.IsValid())
-				{
-					SafeClearBusyBit();
-					return;
-				}
-				++Processor->ChunkGenerations[ChunkIndex];
+		CurrentSubDuration = FPlatformTime::Seconds() - CurrentSubDuration;
+		UnionResult.SpentMs += CurrentSubDuration * 1000.0;
 
-				CurrentSubDuration = FPlatformTime::Seconds() - CurrentSubDuration;
+		if (bSubtractSuccess)
+		{
+			// Apply boolean result for the number of unioned bullets.
+			AppliedCount = UnionCount;
+			WorkMesh = MoveTemp(ResultMesh);
 
-				if (bSubtractSuccess)
-				{
-					// Apply boolean result for the number of unioned bullets.
-					AppliedCount = UnionCount;
-					WorkMesh = MoveTemp(ResultMesh);
+			AccumulateSubtractDuration(ChunkIndex, CurrentSubDuration);
 
-					Processor->AccumulateSubtractDuration(ChunkIndex, CurrentSubDuration);
+			// Mesh simplification runs in the background once this result is published.
+			DamageBounds = UnionResult.PendingCombinedToolMesh.GetBounds(true);
+			bEnableDetailMode = OwnerComponent.IsValid() && OwnerComponent->IsHighDetailMode();
+			bSimplifyDue = ShouldSimplify(WorkMesh.TriangleCount(), ChunkIndex, UnionCount);
 
-					{
-						// Mesh simplification.
+			// Next snapshot is built off the GameThread; apply only swaps the pointer.
+			PublishedMesh = MakeShared<FDynamicMesh3, ESPMode::ThreadSafe>(WorkMesh);
+
+			UpdateUnionSize(ChunkIndex, CurrentSubDuration * 1000.0, TargetMesh.TriangleCount(),
+				UnionResult.PendingCombinedToolMesh.TriangleCount(), UnionCount);
+		}
+		else
+		{ 
+			// Reset accumulation on failure.
+			FChunkState& State = ChunkStates.GetState(ChunkIndex);
+			State.SubtractDurationAccum = 0;
+			State.DurationAccumCount = 0;
+		}
+	}
+
+	EnqueueCompletion(
+		[OwnerComponent = OwnerComponent, LifeTimeToken = LifeTime, ChunkIndex, Result = MoveTemp(WorkMesh), PublishedMesh = MoveTemp(PublishedMesh), AppliedCount, bSimplifyDue, bEnableDetailMode, DamageBounds, DecalsToRemove = MoveTemp(UnionResult.Decals), CompletionBatchIds = MoveTemp(UnionResult.CompletionBatchIds), WorkEpoch = UnionResult.WorkEpoch, SpentMs = UnionResult.SpentMs, AppliedSignal = MoveTemp(AppliedSignal)]() mutable
+		{
+			if (!OwnerComponent.IsValid())
+			{
+				return;
+			}
+
+			// Pipelined batches keep the chunk until the chunk's last in-flight batch is applied.
+			const bool bPipelined = AppliedSignal.IsValid();
+			if (!bPipelined)
+			{
+				OwnerComponent->ClearChunkBusy(ChunkIndex);
+			}
+
+			TSharedPtr<FRealtimeBooleanProcessor, ESPMode::ThreadSafe> Processor =
+				(LifeTimeToken.IsValid() && LifeTimeToken->bAlive.load()) ? LifeTimeToken->Processor.Pin() : nullptr;
+			if (!Processor.IsValid() || OwnerComponent->GetBooleanProcessor() != Processor.Get())
+			{
+				// The pipeline that held the chunk is gone; release it for whoever runs next.
+				OwnerComponent->ClearChunkBusy(ChunkIndex);
+				return;
+			}
+
+#if !UE_BUILD_SHIPPING
+			TRACE_CPUPROFILER_EVENT_SCOPE("ChunkBooleanAsync_ApplyGT");
+#endif
+
+			// The chunk was reset or removed while this result was in flight: do not write it back.
+			if (AppliedCount > 0 && Processor->IsChunkWorkStale(ChunkIndex, WorkEpoch))
+			{
+				Processor->AddWastedBooleanMs(SpentMs);
+				AppliedCount = 0;
+			}
+
+			if (AppliedCount > 0)
+			{
+				double CurrentSetMeshAvgCost = FPlatformTime::Seconds();
+				{
 #if !UE_BUILD_SHIPPING
-						TRACE_CPUPROFILER_EVENT_SCOPE("ChunkBooleanAsync_Simplify");
+					TRACE_CPUPROFILER_EVENT_SCOPE("ChunkBooleanAsync_SetMesh");
 #endif
-						bool bEnableDetailMode = OwnerComponent->IsHighDetailMode();
-						bool bIsSimplified = Processor->TrySimplify(WorkMesh, ChunkIndex, UnionCount, bEnableDetailMode);
+					OwnerComponent->ApplyBooleanOperationResult(MoveTemp(Result), ChunkIndex, bPipelined);
+
+					const int32 NewGeneration = Processor->ChunkGenerations[ChunkIndex].fetch_add(1) + 1;
+					OwnerComponent->PublishChunkMeshSnapshot(ChunkIndex, MoveTemp(PublishedMesh), NewGeneration);
 				}
+				CurrentSetMeshAvgCost = CurrentSetMeshAvgCost - FPlatformTime::Seconds();
 
-					
-					Processor->UpdateUnionSize(ChunkIndex, CurrentSubDuration * 1000.0);
+				Processor->UpdateSimplifyInterval(CurrentSetMeshAvgCost, ChunkIndex);
+
+				Processor->AddChunkDirtyRegion(ChunkIndex, DamageBounds);
+				if (bSimplifyDue)
+				{
+					Processor->RequestBackgroundSimplify(ChunkIndex, bEnableDetailMode);
 				}
-				else
-				{ 
-					// Reset accumulation on failure.
-					FChunkState& State = Processor->ChunkStates.GetState(ChunkIndex);
-					State.SubtractDurationAccum = 0;
-					State.DurationAccumCount = 0;
+
+				if (Processor->IsChunkOverBudget(ChunkIndex))
+				{
+					OwnerComponent->RequestChunkSplit(ChunkIndex);
 				}
-			}
 
-			AsyncTask(ENamedThreads::GameThread,
-				[OwnerComponent, LifeTimeToken, Gen, ChunkIndex, Result = MoveTemp(WorkMesh), AppliedCount, DecalsToRemove = MoveTemp(DecalsToRemove), CompletionBatchIds = MoveTemp(CompletionBatchIds)]() mutable
+				for (const TWeakObjectPtr<UDecalComponent>& Decal : DecalsToRemove)
 				{
-					if (!OwnerComponent.IsValid())
+					if (Decal.IsValid())
 					{
-						return;
+						//Decal->DestroyComponent();
 					}
-					OwnerComponent->ClearChunkBusy(ChunkIndex);
+				}
+			}
 
-					if (!LifeTimeToken.IsValid() || !LifeTimeToken->bAlive.load())
-					{
-						return;
-					}
+			// 배치 완료 추적: 모든 BatchId에 대해 완료 알림
+			for (int32 BatchId : CompletionBatchIds)
+			{
+				OwnerComponent->NotifyBooleanCompleted(BatchId);
+			}
 
-					TSharedPtr<FRealtimeBooleanProcessor, ESPMode::ThreadSafe> Processor = LifeTimeToken->Processor.Pin();
-					if (!Processor.IsValid())
-					{
-						return;
-					}
+			Processor->ChunkHoleCount[ChunkIndex] += AppliedCount;
 
-					if (OwnerComponent->GetBooleanProcessor() != Processor.Get())
-					{
-						return;
-					}
+			if (bPipelined)
+			{
+				// The chunk's next subtract task was waiting on this apply.
+				AppliedSignal->Trigger();
+				Processor->ReleaseChunkPipelineBatch(ChunkIndex);
+			}
+			else
+			{
+				// A batch already unioned while this one was subtracting goes next.
+				Processor->TryStartStagedSubtract(ChunkIndex);
+			}
+			Processor->KickProcessIfNeededPerChunk();
+		});
+}
 
-#if !UE_BUILD_SHIPPING
-					TRACE_CPUPROFILER_EVENT_SCOPE("ChunkBooleanAsync_ApplyGT");
-#endif
+void FRealtimeBooleanProcessor::EnqueueCompletion(TUniqueFunction<void()>&& Completion)
+{
+	CompletionQueue.Enqueue(MoveTemp(Completion));
+	PendingCompletionCount.fetch_add(1);
+}
+
+int32 FRealtimeBooleanProcessor::DrainCompletionQueue(double BudgetMs)
+{
+	check(IsInGameThread());
+
+	if (PendingCompletionCount.load() == 0)
+	{
+		return 0;
+	}
 
-					if (AppliedCount > 0)
-					{
-						double CurrentSetMeshAvgCost = FPlatformTime::Seconds();
-						{
 #if !UE_BUILD_SHIPPING
-							TRACE_CPUPROFILER_EVENT_SCOPE("ChunkBooleanAsync_SetMesh");
+	TRACE_CPUPROFILER_EVENT_SCOPE("BooleanProcessor_DrainCompletions");
 #endif
-							OwnerComponent->ApplyBooleanOperationResult(MoveTemp(Result), ChunkIndex, false);
-						}
-						CurrentSetMeshAvgCost = CurrentSetMeshAvgCost - FPlatformTime::Seconds();
 
-						Processor->UpdateSimplifyInterval(CurrentSetMeshAvgCost, ChunkIndex);
+	// The frame budget is owned by the thread manager so every processor of the game instance shares it.
+	// Without one, the budget covers this call only.
+	URDMThreadManagerSubsystem* ThreadManager = GetThreadManager();
+	double SpentMs = ThreadManager ? ThreadManager->GetResultApplySpentMs() : 0.0;
 
-						for (const TWeakObjectPtr<UDecalComponent>& Decal : DecalsToRemove)
-						{
-							if (Decal.IsValid())
-							{
-								//Decal->DestroyComponent();
-							}
-						}
-					}
+	const bool bUnlimited = BudgetMs <= 0.0;
+	int32 AppliedCount = 0;
 
-					// 배치 완료 추적: 모든 BatchId에 대해 완료 알림
-					for (int32 BatchId : CompletionBatchIds)
-					{
-						OwnerComponent->NotifyBooleanCompleted(BatchId);
-					}
+	TUniqueFunction<void()> Completion;
+	while ((bUnlimited || AppliedCount == 0 || SpentMs < BudgetMs) && CompletionQueue.Dequeue(Completion))
+	{
+		PendingCompletionCount.fetch_sub(1);
 
-					Processor->ChunkHoleCount[ChunkIndex] += AppliedCount;
+		const double StartTime = FPlatformTime::Seconds();
+		Completion();
+		Completion.Reset();
+		const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+		SpentMs += ElapsedMs;
+		if (ThreadManager)
+		{
+			ThreadManager->AddResultApplySpentMs(ElapsedMs);
+		}
 
-					Processor->KickProcessIfNeededPerChunk();
-				});
-		});
+		++AppliedCount;
+
+		// A completion may shut the processor down (e.g. owner reset); stop touching the queue then.
+		if (!LifeTime.IsValid())
+		{
+			break;
+		}
+	}
+
+	TRACE_COUNTER_SET(Counter_PendingCompletions, PendingCompletionCount.load());
+
+	return AppliedCount;
 }
 
-void FRealtimeBooleanProcessor::CancelAllOperations()
-{
-	SetMeshAvgCost.Reset();
+void FRealtimeBooleanProcessor::CancelAllOperations()
+{
+	SetMeshAvgCost.Reset();
+
+	InitInterval = 0;
+
+	HighPriorityQueue.Reset();
+	NormalPriorityQueue.Reset();
+	HighPriorityPending.Reset();
+	NormalPriorityPending.Reset();
+
+	DebugHighQueueCount = 0;
+	DebugNormalQueueCount = 0;
+
+	// Everything already dispatched belongs to the old mesh.
+	for (std::atomic<int32>& Epoch : ChunkWorkEpochs)
+	{
+		Epoch.fetch_add(1);
+	}
+
+	// Reset hole count and caches.
+	ChunkStates.Reset();
+	ChunkHoleCount.Init(OwnerComponent->GetChunkNum(), 0);
+}
+
+void FRealtimeBooleanProcessor::CancelChunkWork(int32 ChunkIndex)
+{
+	if (!ChunkWorkEpochs.IsValidIndex(ChunkIndex))
+	{
+		return;
+	}
+
+	ChunkWorkEpochs[ChunkIndex].fetch_add(1);
 
-	InitInterval = 0;
+	// Route whatever is still in the request queues so this chunk's pending requests can be dropped too.
+	HighPriorityPending.RouteFrom(HighPriorityQueue);
+	NormalPriorityPending.RouteFrom(NormalPriorityQueue);
 
-	FBulletHole Temp;
-	while (HighPriorityQueue.Dequeue(Temp)) {}
-	while (NormalPriorityQueue.Dequeue(Temp)) {}
+	auto DropPending = [this, ChunkIndex](FPendingChunkOps& Pending, int32& DebugCount)
+	{
+		if (!Pending.Buckets.IsValidIndex(ChunkIndex))
+		{
+			return;
+		}
 
-	DebugHighQueueCount = 0;
-	DebugNormalQueueCount = 0;
+		// The bucket stays in ActiveChunks; the next tick unlists it as empty.
+		FChunkPendingBucket& Bucket = Pending.Buckets[ChunkIndex];
+		while (!Bucket.Ops.IsEmpty())
+		{
+			FBulletHole Op = Bucket.Ops.PopFrontValue();
+			DebugCount--;
+			if (OwnerComponent.IsValid())
+			{
+				OwnerComponent->NotifyBooleanSkipped(Op.BatchId);
+			}
+		}
+	};
+	DropPending(HighPriorityPending, DebugHighQueueCount);
+	DropPending(NormalPriorityPending, DebugNormalQueueCount);
+}
 
-	// Reset hole count and caches.
-	ChunkStates.Reset();
-	ChunkHoleCount.Init(OwnerComponent->GetChunkNum(), 0);
+bool FRealtimeBooleanProcessor::IsChunkWorkStale(int32 ChunkIndex, int32 WorkEpoch) const
+{
+	return !ChunkWorkEpochs.IsValidIndex(ChunkIndex) || ChunkWorkEpochs[ChunkIndex].load(std::memory_order_relaxed) != WorkEpoch;
+}
+
+void FRealtimeBooleanProcessor::AddWastedBooleanMs(double Ms)
+{
+	const int64 Micros = static_cast<int64>(Ms * 1000.0);
+	const int64 Total = WastedBooleanMicros.fetch_add(Micros, std::memory_order_relaxed) + Micros;
+	TRACE_COUNTER_SET(Counter_WastedBooleanMs, Total / 1000);
 }
 
 void FRealtimeBooleanProcessor::AccumulateSubtractDuration(int32 ChunkIndex, double CurrentSubDuration)
@@ -1673,7 +2410,7 @@ void FRealtimeBooleanProcessor::UpdateSimplifyInterval(double CurrentSetMeshAvgC
 	}
 }
 
-bool FRealtimeBooleanProcessor::TrySimplify(UE::Geometry::FDynamicMesh3& WorkMesh, int32 ChunkIndex, int32 UnionCount, bool bEnableDetail)
+bool FRealtimeBooleanProcessor::ShouldSimplify(int32 TriCount, int32 ChunkIndex, int32 UnionCount)
 {
 	if (!FRDMCVarHelper::EnableSimplify())
 	{
@@ -1689,7 +2426,6 @@ bool FRealtimeBooleanProcessor::TrySimplify(UE::Geometry::FDynamicMesh3& WorkMes
 	State.Interval += UnionCount;
 	
 	bool bShouldSimplify = false;
-	const int32 TriCount = WorkMesh.TriangleCount();
 
 	if ((TriCount > State.LastSimplifyTriCount * 1.2f &&
 		State.LastSimplifyTriCount > 1000) ||
@@ -1714,42 +2450,183 @@ bool FRealtimeBooleanProcessor::TrySimplify(UE::Geometry::FDynamicMesh3& WorkMes
 
 	if (bShouldSimplify)
 	{
-		State.Reset();	
-		FGeometryScriptPlanarSimplifyOptions SimplifyOptions;
-		// SimplifyOptions.bAutoCompact = true;
-		SimplifyOptions.bAutoCompact = false;
-		SimplifyOptions.AngleThreshold = AngleThreshold;
-		ApplySimplifyToPlanarAsync(&WorkMesh, SimplifyOptions, bEnableDetail);
 		/*
-		 * As of 12/26, the runtime does not access LastSimplifyTriCount on the GT.
+		 * LastSimplifyTriCount is updated when the background simplify publishes;
+		 * until then repeated triggers are absorbed by bSimplifyInFlight.
 		 */
-		State.LastSimplifyTriCount = WorkMesh.TriangleCount();
+		State.Reset();	
 	}
 
 	return bShouldSimplify;
 }
 
-void FRealtimeBooleanProcessor::EnqueueRetryOps(TQueue<FBulletHole, EQueueMode::Mpsc>& Queue, FBulletHoleBatch&& InBatch,
-	UDynamicMeshComponent* TargetMesh, int32 ChunkIndex, int32& DebugCount)
+void FRealtimeBooleanProcessor::RequestBackgroundSimplify(int32 ChunkIndex, bool bEnableDetail)
 {
-	int32 BatchCount = InBatch.Num();
-	if (BatchCount == 0)
+	if (!ChunkStates.States.IsValidIndex(ChunkIndex))
 	{
 		return;
 	}
 
-	FBulletHole Op = {};
-	for (int32 i = 0; i < BatchCount; i++)
+	FChunkState& State = ChunkStates.GetState(ChunkIndex);
+	if (State.bSimplifyInFlight)
+	{
+		// The running job re-runs by itself if the generation moved under it.
+		return;
+	}
+
+	// Only the area damaged since the last simplify is touched.
+	const FAxisAlignedBox3d Region = State.DirtyBounds;
+	State.DirtyBounds = FAxisAlignedBox3d::Empty();
+
+	State.bSimplifyInFlight = true;
+	LaunchBackgroundSimplify(ChunkIndex, bEnableDetail, 0, Region);
+}
+
+void FRealtimeBooleanProcessor::AddChunkDirtyRegion(int32 ChunkIndex, const FAxisAlignedBox3d& Bounds)
+{
+	if (Bounds.IsEmpty() || !ChunkStates.States.IsValidIndex(ChunkIndex))
+	{
+		return;
+	}
+
+	ChunkStates.GetState(ChunkIndex).DirtyBounds.Contain(Bounds);
+}
+
+void FRealtimeBooleanProcessor::LaunchBackgroundSimplify(int32 ChunkIndex, bool bEnableDetail, int32 Attempt, const FAxisAlignedBox3d& Region)
+{
+	FGeometryScriptPlanarSimplifyOptions SimplifyOptions;
+	// SimplifyOptions.bAutoCompact = true;
+	SimplifyOptions.bAutoCompact = false;
+	SimplifyOptions.AngleThreshold = AngleThreshold;
+
+	URDMThreadManagerSubsystem* ThreadManager = GetThreadManager();
+	if (!ThreadManager)
 	{
-		if (InBatch.Get(Op, i))
+		// No worker budget to run on; keep the region so the next subtract requests it again.
+		if (ChunkStates.States.IsValidIndex(ChunkIndex))
 		{
-			Op.ChunkIndex = ChunkIndex;
-			Op.TargetMesh = TargetMesh;
-			Queue.Enqueue(Op);
-			DebugCount++;
+			ChunkStates.GetState(ChunkIndex).bSimplifyInFlight = false;
+			AddChunkDirtyRegion(ChunkIndex, Region);
 		}
-		Op.Reset();
+		return;
 	}
+
+	// A reset or chunk cancel moves the epoch without moving the generation; the result is dropped then.
+	const int32 WorkEpoch = ChunkWorkEpochs.IsValidIndex(ChunkIndex) ? ChunkWorkEpochs[ChunkIndex].load() : 0;
+
+	// Off-screen priority and the lowest class: simplify only uses workers that subtract, union and island removal leave idle.
+	ThreadManager->RequestWork(
+		[OwnerComponent = OwnerComponent, LifeTimeToken = LifeTime, ChunkIndex, bEnableDetail, Attempt, Region, SimplifyOptions, WorkEpoch]()
+		{
+			TSharedPtr<FRealtimeBooleanProcessor, ESPMode::ThreadSafe> WorkerProcessor =
+				LifeTimeToken.IsValid() ? LifeTimeToken->Processor.Pin() : nullptr;
+			if (!WorkerProcessor.IsValid() || !OwnerComponent.IsValid())
+			{
+				return;
+			}
+
+			FChunkMeshSnapshot ChunkSnapshot;
+			if (!OwnerComponent->AcquireChunkMeshSnapshot(ChunkIndex, ChunkSnapshot))
+			{
+				WorkerProcessor->EnqueueCompletion([LifeTimeToken, ChunkIndex, Region, WorkEpoch]()
+				{
+					if (TSharedPtr<FRealtimeBooleanProcessor, ESPMode::ThreadSafe> Processor = LifeTimeToken->Processor.Pin())
+					{
+						if (Processor->ChunkStates.States.IsValidIndex(ChunkIndex))
+						{
+							Processor->ChunkStates.GetState(ChunkIndex).bSimplifyInFlight = false;
+							if (!Processor->IsChunkWorkStale(ChunkIndex, WorkEpoch))
+							{
+								Processor->AddChunkDirtyRegion(ChunkIndex, Region);
+							}
+						}
+					}
+				});
+				return;
+			}
+
+			// Simplify a private copy; the published snapshot stays readable by subtract workers.
+			FDynamicMesh3 SimplifiedMesh = *ChunkSnapshot.Mesh;
+			{
+#if !UE_BUILD_SHIPPING
+				TRACE_CPUPROFILER_EVENT_SCOPE("BackgroundSimplify");
+#endif
+				if (Region.IsEmpty())
+				{
+					ApplySimplifyToPlanarAsync(&SimplifiedMesh, SimplifyOptions, bEnableDetail);
+				}
+				else
+				{
+					ApplySimplifyToPlanarRegionAsync(&SimplifiedMesh, Region, SimplifyOptions, bEnableDetail, MaxSimplifyRegionRatio);
+				}
+			}
+			TSharedPtr<const FDynamicMesh3, ESPMode::ThreadSafe> PublishedMesh =
+				MakeShared<FDynamicMesh3, ESPMode::ThreadSafe>(SimplifiedMesh);
+
+			WorkerProcessor->EnqueueCompletion(
+				[OwnerComponent, LifeTimeToken, ChunkIndex, bEnableDetail, Attempt, Region, WorkEpoch, SourceGeneration = ChunkSnapshot.Generation,
+				Result = MoveTemp(SimplifiedMesh), PublishedMesh = MoveTemp(PublishedMesh)]() mutable
+				{
+					if (!OwnerComponent.IsValid() || !LifeTimeToken.IsValid() || !LifeTimeToken->bAlive.load())
+					{
+						return;
+					}
+
+					TSharedPtr<FRealtimeBooleanProcessor, ESPMode::ThreadSafe> Processor = LifeTimeToken->Processor.Pin();
+					if (!Processor.IsValid() || OwnerComponent->GetBooleanProcessor() != Processor.Get() ||
+						!Processor->ChunkStates.States.IsValidIndex(ChunkIndex))
+					{
+						return;
+					}
+
+					FChunkState& State = Processor->ChunkStates.GetState(ChunkIndex);
+
+					// The chunk was reset or its work cancelled while simplifying: the source mesh is gone, do not retry.
+					if (Processor->IsChunkWorkStale(ChunkIndex, WorkEpoch))
+					{
+						State.bSimplifyInFlight = false;
+						return;
+					}
+
+					// A newer subtract was published while simplifying: the result is stale, run again on the new mesh.
+					if (Processor->ChunkGenerations[ChunkIndex].load() != SourceGeneration)
+					{
+						// Holes published meanwhile join the region of the re-run.
+						FAxisAlignedBox3d RetryRegion = Region;
+						if (!State.DirtyBounds.IsEmpty())
+						{
+							RetryRegion.Contain(State.DirtyBounds);
+						}
+						State.DirtyBounds = FAxisAlignedBox3d::Empty();
+
+						if (Attempt + 1 < MaxSimplifyAttempts)
+						{
+							Processor->LaunchBackgroundSimplify(ChunkIndex, bEnableDetail, Attempt + 1, RetryRegion);
+						}
+						else
+						{
+							// Keep the tri-count trigger armed; the next subtract requests it again.
+							State.bSimplifyInFlight = false;
+							Processor->AddChunkDirtyRegion(ChunkIndex, RetryRegion);
+						}
+						return;
+					}
+
+#if !UE_BUILD_SHIPPING
+					TRACE_CPUPROFILER_EVENT_SCOPE("BackgroundSimplify_ApplyGT");
+#endif
+					State.bSimplifyInFlight = false;
+					State.LastSimplifyTriCount = Result.TriangleCount();
+
+					OwnerComponent->ApplyBooleanOperationResult(MoveTemp(Result), ChunkIndex, true);
+
+					const int32 NewGeneration = Processor->ChunkGenerations[ChunkIndex].fetch_add(1) + 1;
+					OwnerComponent->PublishChunkMeshSnapshot(ChunkIndex, MoveTemp(PublishedMesh), NewGeneration);
+				});
+		},
+		OwnerComponent.Get(),
+		ERDMWorkClass::Simplify,
+		ERDMWorkPriority::OffScreen);
 }
 
 int32& FRealtimeBooleanProcessor::GetChunkInterval(int32 ChunkIndex)
@@ -1772,6 +2649,73 @@ int32 FRealtimeBooleanProcessor::GetChunkHoleCount(const UPrimitiveComponent* Ch
 	return GetChunkHoleCount(ChunkIndex);
 }
 
+bool FRealtimeBooleanProcessor::SubtractFromChunkMesh(const UE::Geometry::FDynamicMesh3& ChunkMesh,
+                                                      const UE::Geometry::FDynamicMesh3& ToolMesh,
+                                                      UE::Geometry::FDynamicMesh3& OutputMesh,
+                                                      const FGeometryScriptMeshBooleanOptions& Options) const
+{
+	URealtimeDestructibleMeshComponent* Owner = OwnerComponent.Get();
+	if (Owner && Owner->IsLocalizedBooleanEnabled())
+	{
+		if (ApplyLocalizedSubtractAsync(ChunkMesh, ToolMesh, OutputMesh, Options, Owner->GetLocalizedBooleanMaxPatchRatio()))
+		{
+			return true;
+		}
+		OutputMesh.Clear();
+	}
+
+	return ApplyMeshBooleanAsync(&ChunkMesh, &ToolMesh, &OutputMesh, EGeometryScriptBooleanOperation::Subtract, Options);
+}
+
+bool FRealtimeBooleanProcessor::ApplyLocalizedSubtractAsync(const UE::Geometry::FDynamicMesh3& ChunkMesh,
+                                                            const UE::Geometry::FDynamicMesh3& ToolMesh,
+                                                            UE::Geometry::FDynamicMesh3& OutputMesh,
+                                                            const FGeometryScriptMeshBooleanOptions& Options,
+                                                            float MaxPatchRatio)
+{
+#if !UE_BUILD_SHIPPING
+	TRACE_CPUPROFILER_EVENT_SCOPE("LocalizedSubtract");
+#endif
+	using namespace UE::Geometry;
+
+	if (ChunkMesh.TriangleCount() == 0 || ToolMesh.TriangleCount() == 0)
+	{
+		return false;
+	}
+
+	const FAxisAlignedBox3d ToolBounds = ToolMesh.GetBounds(true);
+	if (ToolBounds.IsEmpty())
+	{
+		return false;
+	}
+
+	/*
+	 * Pad by the tool's own size so the back face of thin walls is pulled into the patch.
+	 * A one-sided patch has no inside, and the boolean would drop the hole's walls.
+	 */
+	FAxisAlignedBox3d PatchBounds = ToolBounds;
+	PatchBounds.Expand(FMath::Max(ToolBounds.MaxDim(), 1.0));
+
+	// The boolean keeps the patch's open edges in place, so the shared extract/weld helper applies.
+	return ApplyToMeshRegion(ChunkMesh, PatchBounds, MaxPatchRatio,
+		[&ToolMesh, &Options](FDynamicMesh3& PatchMesh)
+		{
+#if !UE_BUILD_SHIPPING
+			TRACE_CPUPROFILER_EVENT_SCOPE("LocalizedSubtract_Boolean");
+#endif
+			FMeshScratchPool::FScopedMesh PatchResult = FMeshScratchPool::Acquire();
+			if (!ApplyMeshBooleanAsync(&PatchMesh, &ToolMesh, PatchResult.Get(), EGeometryScriptBooleanOperation::Subtract, Options))
+			{
+				return false;
+			}
+
+			// Swap so the pooled mesh keeps the patch's buffers for reuse.
+			Swap(PatchMesh, *PatchResult.Get());
+			return true;
+		},
+		OutputMesh);
+}
+
 bool FRealtimeBooleanProcessor::ApplyMeshBooleanAsync(const UE::Geometry::FDynamicMesh3* TargetMesh,
                                                       const UE::Geometry::FDynamicMesh3* ToolMesh,
                                                       UE::Geometry::FDynamicMesh3* OutputMesh,
@@ -1916,7 +2860,7 @@ bool FRealtimeBooleanProcessor::ApplyMeshBooleanAsync(const UE::Geometry::FDynam
 	return false;
 }
 
-void FRealtimeBooleanProcessor::ApplySimplifyToPlanarAsync(UE::Geometry::FDynamicMesh3* TargetMesh, FGeometryScriptPlanarSimplifyOptions Options, bool bEnableDetail)
+void FRealtimeBooleanProcessor::ApplySimplifyToPlanarAsync(UE::Geometry::FDynamicMesh3* TargetMesh, FGeometryScriptPlanarSimplifyOptions Options, bool bEnableDetail, bool bFixBoundaryVertices)
 {
 	if (!TargetMesh)
 	{
@@ -1926,6 +2870,21 @@ void FRealtimeBooleanProcessor::ApplySimplifyToPlanarAsync(UE::Geometry::FDynami
 
 	FQEMSimplification Simplifier(TargetMesh);	
 
+	// Pins open edges and their vertices so a simplified patch still welds back onto the untouched mesh.
+	auto PinBoundary = [TargetMesh](FMeshConstraints& Constraints)
+	{
+		const FEdgeConstraint FixedEdge(EEdgeRefineFlags::FullyConstrained);
+		const FVertexConstraint FixedVertex(true, false);
+		for (int32 EdgeID : TargetMesh->BoundaryEdgeIndicesItr())
+		{
+			Constraints.SetOrUpdateEdgeConstraint(EdgeID, FixedEdge);
+
+			const FIndex2i EdgeV = TargetMesh->GetEdgeV(EdgeID);
+			Constraints.SetOrUpdateVertexConstraint(EdgeV.A, FixedVertex);
+			Constraints.SetOrUpdateVertexConstraint(EdgeV.B, FixedVertex);
+		}
+	};
+
 	if (bEnableDetail)
 	{
 		if (!TargetMesh->HasAttributes())
@@ -1943,6 +2902,10 @@ void FRealtimeBooleanProcessor::ApplySimplifyToPlanarAsync(UE::Geometry::FDynami
 			SimplifyOptions.PreserveEdges.Material = MeshClusterSimplify::FSimplifyOptions::EConstraintLevel::Constrained;
 			SimplifyOptions.bTransferAttributes = true;
 			SimplifyOptions.bTransferGroups = true;
+			if (bFixBoundaryVertices)
+			{
+				SimplifyOptions.PreserveEdges.Boundary = MeshClusterSimplify::FSimplifyOptions::EConstraintLevel::Fixed;
+			}
 
 			FDynamicMesh3 SimplifiedMesh;
 			if (MeshClusterSimplify::Simplify(*TargetMesh, SimplifiedMesh, SimplifyOptions))
@@ -2037,6 +3000,10 @@ void FRealtimeBooleanProcessor::ApplySimplifyToPlanarAsync(UE::Geometry::FDynami
 			// Protect boundary edges.
 			// Boundary edge: edge with only one adjacent triangle.
 			Simplifier.MeshBoundaryConstraint = EEdgeRefineFlags::NoCollapse;
+			if (bFixBoundaryVertices)
+			{
+				PinBoundary(Constraints);
+			}
 
 			// Allow global seam collapse for interior simplification; surface seams are constrained externally.
 			Simplifier.bAllowSeamCollapse = true;
@@ -2058,6 +3025,15 @@ void FRealtimeBooleanProcessor::ApplySimplifyToPlanarAsync(UE::Geometry::FDynami
 	{
 		Simplifier.CollapseMode = FQEMSimplification::ESimplificationCollapseModes::AverageVertexPosition;
 
+		if (bFixBoundaryVertices)
+		{
+			TOptional<FMeshConstraints> BoundaryConstraints;
+			BoundaryConstraints.Emplace();
+			PinBoundary(BoundaryConstraints.GetValue());
+			Simplifier.MeshBoundaryConstraint = EEdgeRefineFlags::FullyConstrained;
+			Simplifier.SetExternalConstraints(MoveTemp(BoundaryConstraints));
+		}
+
 		Simplifier.SimplifyToMinimalPlanar(FMath::Max(0.001, Options.AngleThreshold));
 	}
 
@@ -2103,4 +3079,191 @@ void FRealtimeBooleanProcessor::ApplyUniformRemesh(FDynamicMesh3* TargetMesh, do
 	}
 
 	TargetMesh->CompactInPlace();
+}
+
+bool FRealtimeBooleanProcessor::ApplyToMeshRegion(UE::Geometry::FDynamicMesh3& TargetMesh,
+                                                  const UE::Geometry::FAxisAlignedBox3d& Region,
+                                                  float MaxRegionRatio,
+                                                  TFunctionRef<bool(UE::Geometry::FDynamicMesh3&)> RegionOp)
+{
+	FDynamicMesh3 ResultMesh;
+	if (!ApplyToMeshRegion(TargetMesh, Region, MaxRegionRatio, RegionOp, ResultMesh))
+	{
+		return false;
+	}
+
+	TargetMesh = MoveTemp(ResultMesh);
+	return true;
+}
+
+bool FRealtimeBooleanProcessor::ApplyToMeshRegion(const UE::Geometry::FDynamicMesh3& SourceMesh,
+                                                  const UE::Geometry::FAxisAlignedBox3d& Region,
+                                                  float MaxRegionRatio,
+                                                  TFunctionRef<bool(UE::Geometry::FDynamicMesh3&)> RegionOp,
+                                                  UE::Geometry::FDynamicMesh3& OutMesh)
+{
+#if !UE_BUILD_SHIPPING
+	TRACE_CPUPROFILER_EVENT_SCOPE("ApplyToMeshRegion");
+#endif
+	if (SourceMesh.TriangleCount() == 0 || Region.IsEmpty())
+	{
+		return false;
+	}
+
+	TArray<int32> RegionTriangles;
+	{
+#if !UE_BUILD_SHIPPING
+		TRACE_CPUPROFILER_EVENT_SCOPE("ApplyToMeshRegion_Select");
+#endif
+		for (int32 TriID : SourceMesh.TriangleIndicesItr())
+		{
+			FVector3d A, B, C;
+			SourceMesh.GetTriVertices(TriID, A, B, C);
+
+			FAxisAlignedBox3d TriBounds(A, B);
+			TriBounds.Contain(C);
+			if (Region.Intersects(TriBounds))
+			{
+				RegionTriangles.Add(TriID);
+			}
+		}
+	}
+
+	// Nothing there, or the region is most of the mesh: the caller runs the whole-mesh version.
+	if (RegionTriangles.Num() == 0 ||
+		RegionTriangles.Num() > FMath::FloorToInt32(SourceMesh.TriangleCount() * MaxRegionRatio))
+	{
+		return false;
+	}
+
+	// Extract the region with the mesh's attributes (UVs, normals, material IDs, groups).
+	FDynamicMesh3 RegionMesh;
+	RegionMesh.EnableMatchingAttributes(SourceMesh);
+	{
+		FDynamicMeshEditor RegionEditor(&RegionMesh);
+		FMeshIndexMappings RegionMappings;
+		FDynamicMeshEditResult RegionEditResult;
+		RegionEditor.AppendTriangles(&SourceMesh, RegionTriangles, RegionMappings, RegionEditResult, false);
+	}
+
+	// The operation must keep the region's open edges in place (they are the seam).
+	if (!RegionOp(RegionMesh))
+	{
+		return false;
+	}
+
+	auto CountBoundaryEdges = [](const FDynamicMesh3& Mesh)
+	{
+		int32 Count = 0;
+		for (int32 EdgeID : Mesh.EdgeIndicesItr())
+		{
+			if (Mesh.IsBoundaryEdge(EdgeID))
+			{
+				++Count;
+			}
+		}
+		return Count;
+	};
+	const int32 SourceBoundaryEdgeCount = CountBoundaryEdges(SourceMesh);
+
+	// Replace the region in a copy of the mesh with the processed region.
+	{
+#if !UE_BUILD_SHIPPING
+		TRACE_CPUPROFILER_EVENT_SCOPE("ApplyToMeshRegion_Stitch");
+#endif
+		OutMesh = SourceMesh;
+
+		FDynamicMeshEditor ResultEditor(&OutMesh);
+		if (!ResultEditor.RemoveTriangles(RegionTriangles, true))
+		{
+			return false;
+		}
+
+		FMeshIndexMappings ResultMappings;
+		ResultEditor.AppendMesh(&RegionMesh, ResultMappings);
+
+		TSet<int32> SeamEdges;
+		for (int32 EdgeID : OutMesh.BoundaryEdgeIndicesItr())
+		{
+			SeamEdges.Add(EdgeID);
+		}
+
+		if (SeamEdges.Num() > 0)
+		{
+			FMergeCoincidentMeshEdges Welder(&OutMesh);
+			Welder.EdgesToMerge = &SeamEdges;
+			Welder.OnlyUniquePairs = true;
+			// Seam attributes were shared before extraction, so weld them back together too.
+			Welder.bWeldAttrsOnMergedEdges = true;
+			Welder.MergeVertexTolerance = 0.001;
+			Welder.MergeSearchTolerance = 0.001;
+			Welder.Apply();
+		}
+
+		OutMesh.CompactInPlace();
+	}
+
+	// Any boundary the source did not already have means the seam did not close.
+	const int32 ResultBoundaryEdgeCount = CountBoundaryEdges(OutMesh);
+	if (ResultBoundaryEdgeCount > SourceBoundaryEdgeCount)
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("[MeshRegion] Region seam left %d open edges, falling back to the whole mesh"),
+			ResultBoundaryEdgeCount - SourceBoundaryEdgeCount);
+		return false;
+	}
+
+	return true;
+}
+
+void FRealtimeBooleanProcessor::ApplySimplifyToPlanarRegionAsync(UE::Geometry::FDynamicMesh3* TargetMesh,
+                                                                 const UE::Geometry::FAxisAlignedBox3d& Region,
+                                                                 FGeometryScriptPlanarSimplifyOptions Options,
+                                                                 bool bEnableDetail,
+                                                                 float MaxRegionRatio)
+{
+	if (!TargetMesh)
+	{
+		return;
+	}
+
+	// Tool bounds only cover the cut; a margin lets the simplifier merge the split faces around it.
+	FAxisAlignedBox3d PaddedRegion = Region;
+	PaddedRegion.Expand(FMath::Max(Region.MaxDim() * 0.25, 1.0));
+
+	const bool bRegionApplied = ApplyToMeshRegion(*TargetMesh, PaddedRegion, MaxRegionRatio,
+		[&Options, bEnableDetail](FDynamicMesh3& RegionMesh)
+		{
+			ApplySimplifyToPlanarAsync(&RegionMesh, Options, bEnableDetail, true);
+			return true;
+		});
+
+	if (!bRegionApplied)
+	{
+		ApplySimplifyToPlanarAsync(TargetMesh, Options, bEnableDetail);
+	}
+}
+
+void FRealtimeBooleanProcessor::ApplyUniformRemeshRegion(UE::Geometry::FDynamicMesh3* TargetMesh,
+                                                         const UE::Geometry::FAxisAlignedBox3d& Region,
+                                                         double TargetEdgeLength,
+                                                         int32 NumPasses,
+                                                         float MaxRegionRatio)
+{
+	if (!TargetMesh)
+	{
+		return;
+	}
+
+	// ApplyUniformRemesh fully constrains open edges, which keeps the region seam in place.
+	const bool bRegionApplied = ApplyToMeshRegion(*TargetMesh, Region, MaxRegionRatio,
+		[TargetEdgeLength, NumPasses](FDynamicMesh3& RegionMesh)
+		{
+			ApplyUniformRemesh(&RegionMesh, TargetEdgeLength, NumPasses);
+			return true;
+		});
+
+	if (!bRegionApplied)
+	{
+		ApplyUniformRemesh(TargetMesh, TargetEdgeLength, NumPasses);
+	}
 }
\ No newline at end of file
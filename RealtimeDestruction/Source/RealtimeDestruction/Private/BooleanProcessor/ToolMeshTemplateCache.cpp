@@ -0,0 +1,165 @@
+// Copyright (c) 2026 LazyDevelopers <lazydeveloper24@gmail.com>. All rights reserved.
+// This plugin is distributed under the Fab Standard License.
+//
+// This product was independently developed by us while participating in the Epic Project, a developer-support
+// program of the KRAFTON JUNGLE GameTech Lab. All rights, title, and interest in and to the product are exclusively
+// vested in us. Krafton, Inc. was not involved in its development and distribution and disclaims all representations
+// and warranties, express or implied, and assumes no responsibility or liability for any consequences arising from
+// the use of this product.
+
+
+#include "BooleanProcessor/ToolMeshTemplateCache.h"
+#include "DynamicMesh/DynamicMesh3.h"
+#include "DynamicMesh/DynamicMeshAttributeSet.h"
+#include "Generators/SphereGenerator.h"
+#include "Generators/SweepGenerator.h"
+#include "Misc/ScopeRWLock.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+using namespace UE::Geometry;
+
+FToolMeshTemplateCache& FToolMeshTemplateCache::Get()
+{
+	static FToolMeshTemplateCache Instance;
+	return Instance;
+}
+
+TSharedPtr<const FDynamicMesh3, ESPMode::ThreadSafe> FToolMeshTemplateCache::FindOrCreate(
+	EDestructionToolShape ToolShape,
+	const FDestructionToolShapeParams& ShapeParams)
+{
+	const FTemplateKey Key = MakeKey(ToolShape, ShapeParams);
+
+	{
+		FReadScopeLock ReadLock(TemplateLock);
+		if (const TSharedPtr<const FDynamicMesh3, ESPMode::ThreadSafe>* Found = Templates.Find(Key))
+		{
+			return *Found;
+		}
+	}
+
+	// Generate outside the lock; if another thread raced us, keep whichever was stored first.
+	TSharedPtr<const FDynamicMesh3, ESPMode::ThreadSafe> NewTemplate = BuildTemplate(Key);
+
+	FWriteScopeLock WriteLock(TemplateLock);
+	if (const TSharedPtr<const FDynamicMesh3, ESPMode::ThreadSafe>* Found = Templates.Find(Key))
+	{
+		return *Found;
+	}
+
+	if (Templates.Num() >= MaxTemplates)
+	{
+		Templates.Reset();
+	}
+
+	Templates.Add(Key, NewTemplate);
+	return NewTemplate;
+}
+
+void FToolMeshTemplateCache::Reset()
+{
+	FWriteScopeLock WriteLock(TemplateLock);
+	Templates.Reset();
+}
+
+int32 FToolMeshTemplateCache::Num() const
+{
+	FReadScopeLock ReadLock(TemplateLock);
+	return Templates.Num();
+}
+
+FToolMeshTemplateCache::FTemplateKey FToolMeshTemplateCache::MakeKey(
+	EDestructionToolShape ToolShape,
+	const FDestructionToolShapeParams& ShapeParams)
+{
+	auto Quantize = [](float Value)
+	{
+		return FMath::RoundToInt32(Value / QuantizeStep);
+	};
+
+	// Only the parameters that affect the generated primitive take part in the key.
+	FTemplateKey Key;
+	Key.Shape = ToolShape;
+	Key.QuantizedRadius = Quantize(ShapeParams.Radius);
+
+	if (ToolShape == EDestructionToolShape::Sphere)
+	{
+		Key.Steps0 = ShapeParams.StepsPhi;
+		Key.Steps1 = ShapeParams.StepsTheta;
+	}
+	else
+	{
+		// Any non-sphere shape is generated as a cylinder.
+		Key.Shape = EDestructionToolShape::Cylinder;
+		Key.QuantizedHeight = Quantize(ShapeParams.Height + ShapeParams.SurfaceMargin);
+		Key.Steps0 = ShapeParams.RadiusSteps;
+		Key.Steps1 = ShapeParams.HeightSubdivisions;
+		Key.bCapped = ShapeParams.bCapped;
+	}
+
+	return Key;
+}
+
+TSharedPtr<const FDynamicMesh3, ESPMode::ThreadSafe> FToolMeshTemplateCache::BuildTemplate(const FTemplateKey& Key)
+{
+#if !UE_BUILD_SHIPPING
+	TRACE_CPUPROFILER_EVENT_SCOPE("ToolMeshTemplateCache_Build");
+#endif
+
+	const float Radius = FMath::Max(FMathf::ZeroTolerance, Key.QuantizedRadius * QuantizeStep);
+
+	/*
+	 * Same generator setup as the Geometry Script AppendSphereLatLong / AppendCylinder calls
+	 * this replaces (single polygroup, sphere centered, cylinder based at the origin, default
+	 * bFlipOrientation), without needing a UDynamicMesh, so it can run off the GameThread.
+	 */
+	TSharedPtr<FDynamicMesh3, ESPMode::ThreadSafe> Mesh;
+	if (Key.Shape == EDestructionToolShape::Sphere)
+	{
+		FSphereGenerator SphereGenerator;
+		SphereGenerator.Radius = Radius;
+		SphereGenerator.NumPhi = FMath::Max(3, Key.Steps0);
+		SphereGenerator.NumTheta = FMath::Max(3, Key.Steps1);
+		SphereGenerator.bPolygroupPerQuad = false;
+		SphereGenerator.Generate();
+
+		Mesh = MakeShared<FDynamicMesh3, ESPMode::ThreadSafe>(&SphereGenerator);
+	}
+	else
+	{
+		FCylinderGenerator CylinderGenerator;
+		CylinderGenerator.Radius[0] = Radius;
+		CylinderGenerator.Radius[1] = Radius;
+		CylinderGenerator.Height = FMath::Max(FMathf::ZeroTolerance, Key.QuantizedHeight * QuantizeStep);
+		CylinderGenerator.AngleSamples = FMath::Max(3, Key.Steps0);
+		CylinderGenerator.LengthSamples = FMath::Max(0, Key.Steps1);
+		CylinderGenerator.bCapped = Key.bCapped;
+		CylinderGenerator.bPolygroupPerQuad = false;
+		CylinderGenerator.Generate();
+
+		Mesh = MakeShared<FDynamicMesh3, ESPMode::ThreadSafe>(&CylinderGenerator);
+	}
+
+	// SingleGroup mode.
+	for (int32 TriID : Mesh->TriangleIndicesItr())
+	{
+		Mesh->SetTriangleGroup(TriID, 0);
+	}
+
+	// FGeometryScriptPrimitiveOptions::bFlipOrientation defaults to true; Geometry Script reverses
+	// the winding and negates the normal overlay. Boolean operations depend on this orientation.
+	Mesh->ReverseOrientation(true);
+	if (Mesh->HasAttributes())
+	{
+		FDynamicMeshNormalOverlay* Normals = Mesh->Attributes()->PrimaryNormals();
+		if (Normals)
+		{
+			for (int32 ElementID : Normals->ElementIndicesItr())
+			{
+				Normals->SetElement(ElementID, -Normals->GetElement(ElementID));
+			}
+		}
+	}
+
+	return Mesh;
+}
@@ -30,6 +30,7 @@
 #include "GeometryCollection/GeometryCollectionComponent.h"
 
 #include "Settings/RDMSetting.h"
+#include "BooleanProcessor/ToolMeshTemplateCache.h"
 #if WITH_EDITOR
 #include "GeometryCollection/GeometryCollectionConversion.h"
 //Fracturing
@@ -55,6 +56,8 @@
 #include "BulletClusterComponent.h"
 #include "Algo/Unique.h"
 #include "StructuralIntegrity/CellDestructionSystem.h"
+#include "StructuralIntegrity/StructuralIntegrityAsync.h"
+#include "Subsystems/RDMThreadManagerSubsystem.h"
 #include "Data/ImpactProfileDataAsset.h"
 #include "ProceduralMeshComponent.h"
 #if WITH_EDITOR
@@ -65,6 +68,8 @@
 #include "Engine/GameInstance.h"
 #include "Engine/Engine.h"
 #include "Subsystems/DestructionGameInstanceSubsystem.h"
+#include "Tasks/Task.h"
+#include "Async/Async.h"
 
 //////////////////////////////////////////////////////////////////////////
 // FCompactDestructionOp 구현 (언리얼 내장 NetQuantize 사용)
@@ -267,6 +272,10 @@ void URealtimeDestructibleMeshComponent::ResetToSourceMesh()
 	
 	bIsInitialized = false;
 	InitializeFromStaticMeshInternal(SourceStaticMesh, true);
+
+	InvalidateAllChunkMeshSnapshots();
+	PendingRenderUpdateChunks.Reset();
+	ChunkRenderUpdateTimes.Reset();
 }
 
 // 현재는 RequestDestruction에서만 호출됨
@@ -511,8 +520,8 @@ FDestructionResult URealtimeDestructibleMeshComponent::DestructionLogic(const FR
 				}
 
 				// 이웃 셀들의 청크도 dirty (새로 표면이 될 수 있음)
-				const FIntArray& Neighbors = GridCellLayout.GetCellNeighbors(CellId);
-				for (int32 NeighborId : Neighbors.Values)
+				const FCellNeighborList Neighbors = GridCellLayout.GetCellNeighbors(CellId);
+				for (int32 NeighborId : Neighbors)
 				{
 					int32 NeighborChunkIdx = GetCollisionChunkIndexForCell(NeighborId);
 					if (NeighborChunkIdx != INDEX_NONE)
@@ -623,8 +632,8 @@ void URealtimeDestructibleMeshComponent::DisconnectedCellStateLogic(const TArray
 		{
 			for (int32 DestroyedCellId : Result.NewlyDestroyedCells)
 			{
-				const FIntArray& Neighbors = GridCellLayout.GetCellNeighbors(DestroyedCellId);
-				for (int32 NeighborId : Neighbors.Values)
+				const FCellNeighborList Neighbors = GridCellLayout.GetCellNeighbors(DestroyedCellId);
+				for (int32 NeighborId : Neighbors)
 				{
 					// 파괴되지않고, 존재하는 이웃 Cell만 순회 
 					if (!CellState.DestroyedCells.Contains(NeighborId) &&
@@ -639,7 +648,7 @@ void URealtimeDestructibleMeshComponent::DisconnectedCellStateLogic(const TArray
 			{
 				for (int32 AffectedCellId : Result.AffectedCells)
 				{
-					const FIntArray& Neighbors = GridCellLayout.GetCellNeighbors(AffectedCellId);
+					const FCellNeighborList Neighbors = GridCellLayout.GetCellNeighbors(AffectedCellId);
 
 					for (int32 NeighborId : Neighbors)
 					{
@@ -669,19 +678,62 @@ void URealtimeDestructibleMeshComponent::DisconnectedCellStateLogic(const TArray
 	//UE_LOG(LogTemp, Warning, TEXT("[BFS #%d] FindDisconnectedCells END - took %.3f ms, found %d disconnected"),
 	//	BFSCallCount, (BFSEndTime - BFSStartTime) * 1000.0, DisconnectedCells.Num());
 	 
+	// 데칼 정리 (데디서버에서는 불필요)
+	if (!GetWorld() || GetWorld()->GetNetMode() != NM_DedicatedServer)
+	{ 
+		TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_CleanDecal);
+		for (const FDestructionResult& Result : AllResults)
+		{
+			ProcessDecalRemoval(Result);
+		}
+	}
+
+	// 비동기 모드: 연결성 분석 + 그룹화는 워커에서 스냅샷으로 수행, 게임 스레드는 결과 적용만
+	if (bAsyncStructuralIntegrity && !bForceRun && AffectedNeighborCells.Num() > 0)
+	{
+		PendingDetachSeedCells.Append(AffectedNeighborCells);
+		LaunchDetachAnalysis();
+
+		// Late Join용: 현재 파괴 셀 상태 스냅샷 갱신 (서버에서만)
+		if (GetOwner() && GetOwner()->HasAuthority())
+		{
+			LateJoinDestroyedCells = CellState.DestroyedCells.Array();
+		}
+
+#if !UE_BUILD_SHIPPING
+		bShouldDebugUpdate = true;
+#endif
+		return;
+	}
+
+	// 비동기 모드에서 시드가 없으면 탐색할 것이 없음: 진행 중인 분석을 기다리지 않고 빈 결과만 적용
+	// (IncrementalConnectivity를 건드리지 않으므로 워커와 겹쳐도 안전)
+	if (bAsyncStructuralIntegrity && !bForceRun && AffectedNeighborCells.Num() == 0)
+	{
+		ApplyDetachedCells(TSet<int32>(), TArray<TArray<int32>>());
+		return;
+	}
+
+	// 동기 경로도 IncrementalConnectivity를 쓰므로 진행 중인 분석을 먼저 적용하고, 남은 시드는 이번 탐색에 합침
+	FlushDetachAnalysis();
+	if (PendingDetachSeedCells.Num() > 0)
+	{
+		AffectedNeighborCells.Append(PendingDetachSeedCells);
+		PendingDetachSeedCells.Reset();
+	}
+
 	TSet<int32> DisconnectedCells; 
 	if (AffectedNeighborCells.Num() > 0)
 	{
-		TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_FindDisconnectedCellsFromAffected);
+		TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_FindDisconnectedCellsIncremental);
 
+		// 손상 주변 셀에서만 탐색 시작, 앵커까지의 거리장은 호출 간 캐시
 		const ENetMode NetMode = GetWorld()->GetNetMode();
-		DisconnectedCells = FCellDestructionSystem::FindDisconnectedCellsFromAffected(
+		DisconnectedCells = FCellDestructionSystem::FindDisconnectedCellsIncremental(
 			GridCellLayout,
-			SupercellState ,
 			CellState,
 			AffectedNeighborCells,
-			CellContext,
-			true && SupercellState.IsValid() ,
+			IncrementalConnectivity,
 			bEnableSubcell && (NetMode == NM_Standalone)
 		);
 	}
@@ -700,19 +752,28 @@ void URealtimeDestructibleMeshComponent::DisconnectedCellStateLogic(const TArray
 	 
 	UE_LOG(LogTemp, Log, TEXT("[Cell] Phase 2: %d Cells disconnected"), DisconnectedCells.Num()); 
 
+	//=====================================================================
+	// Phase 3: 분리된 셀 그룹화
+	//=====================================================================
+	TArray<TArray<int32>> NewDetachedGroups;
+	if (DisconnectedCells.Num() > 0)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_Phase3); 
+		NewDetachedGroups = FCellDestructionSystem::GroupDetachedCells(
+			GridCellLayout,
+			DisconnectedCells,
+			CellState.DestroyedCells);
+	}
+
+	ApplyDetachedCells(DisconnectedCells, NewDetachedGroups);
+}
+
+void URealtimeDestructibleMeshComponent::ApplyDetachedCells(const TSet<int32>& DisconnectedCells, const TArray<TArray<int32>>& NewDetachedGroups)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_ApplyDetachedCells);
+
 	if (DisconnectedCells.Num() > 0)
 	{
-		//=====================================================================
-		// Phase 3: 분리된 셀 그룹화
-		//=====================================================================
-		TArray<TArray<int32>> NewDetachedGroups;
-		{
-			TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_Phase3); 
-			NewDetachedGroups = FCellDestructionSystem::GroupDetachedCells(
-				GridCellLayout,
-				DisconnectedCells,
-				CellState.DestroyedCells);
-		}
 		for (const TArray<int32>& Group : NewDetachedGroups)
 		{
 			CellState.AddDetachedGroup(Group);
@@ -779,8 +840,8 @@ void URealtimeDestructibleMeshComponent::DisconnectedCellStateLogic(const TArray
 					DetachedDirtyChunks.Add(ChunkIdx);
 				}
 				// 이웃 셀 청크도 dirty (새 표면 될 수 있음)
-				const FIntArray& Neighbors = GridCellLayout.GetCellNeighbors(CellId);
-				for (int32 NeighborId : Neighbors.Values)
+				const FCellNeighborList Neighbors = GridCellLayout.GetCellNeighbors(CellId);
+				for (int32 NeighborId : Neighbors)
 				{
 					int32 NeighborChunkIdx = GetCollisionChunkIndexForCell(NeighborId);
 					if (NeighborChunkIdx != INDEX_NONE)
@@ -811,21 +872,13 @@ void URealtimeDestructibleMeshComponent::DisconnectedCellStateLogic(const TArray
 		}
 	}
 
-	// 데칼 정리 (데디서버에서는 불필요)
-	if (!GetWorld() || GetWorld()->GetNetMode() != NM_DedicatedServer)
+	// 분리된 셀의 데칼 정리 (데디서버에서는 불필요)
+	if (DisconnectedCells.Num() > 0 && (!GetWorld() || GetWorld()->GetNetMode() != NM_DedicatedServer))
 	{ 
 		TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_CleanDecal);
-		for (const FDestructionResult& Result : AllResults)
-		{
-			ProcessDecalRemoval(Result);
-		}
-	
-		if (DisconnectedCells.Num() > 0)
-		{
-			FDestructionResult DetachResult;
-			DetachResult.NewlyDestroyedCells = DisconnectedCells.Array();
-			ProcessDecalRemoval(DetachResult);
-		}
+		FDestructionResult DetachResult;
+		DetachResult.NewlyDestroyedCells = DisconnectedCells.Array();
+		ProcessDecalRemoval(DetachResult);
 	}
 
 	UE_LOG(LogTemp, Log, TEXT("UpdateCellStateFromDestruction Complete: Destroyed=%d, DetachedGroups=%d"),
@@ -843,6 +896,133 @@ void URealtimeDestructibleMeshComponent::DisconnectedCellStateLogic(const TArray
 #endif
 }
 
+void URealtimeDestructibleMeshComponent::LaunchDetachAnalysis()
+{
+	// 한 번에 하나만 실행 (IncrementalConnectivity를 단독으로 사용)
+	if (DetachAnalysisJob.IsValid() || PendingDetachSeedCells.Num() == 0)
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_LaunchDetachAnalysis);
+
+	const ENetMode NetMode = GetWorld() ? GetWorld()->GetNetMode() : NM_Standalone;
+
+	TSharedPtr<FDetachAnalysisJob, ESPMode::ThreadSafe> Job = MakeShared<FDetachAnalysisJob, ESPMode::ThreadSafe>();
+	Job->Snapshot = CellState;	// 밀집 버퍼 복사 (비트셋 + SubCell 마스크)
+	Job->SeedCells = MoveTemp(PendingDetachSeedCells);
+	Job->bEnableSubcell = bEnableSubcell && (NetMode == NM_Standalone);
+	Job->StateEpoch = CellStateEpoch;
+	Job->DestroyedCellCount = CellState.DestroyedCells.Num();
+	PendingDetachSeedCells.Reset();
+
+	// GridCellLayout/IncrementalConnectivity는 작업 중 게임 스레드가 건드리지 않음 (Flush/Cancel 후에만 변경)
+	const FGridCellLayout* Layout = &GridCellLayout;
+	FIncrementalConnectivityCache* Connectivity = &IncrementalConnectivity;
+	TFunction<void()> Work = [Job, Layout, Connectivity]()
+	{
+		Job->Run(*Layout, *Connectivity);
+	};
+
+	if (URDMThreadManagerSubsystem* ThreadManager = URDMThreadManagerSubsystem::Get(GetWorld()))
+	{
+		const ERDMWorkPriority Priority = (GetOwner() && GetOwner()->WasRecentlyRendered(0.5f))
+			? ERDMWorkPriority::Visible
+			: ERDMWorkPriority::OffScreen;
+		DetachAnalysisTask = ThreadManager->RequestTask(MoveTemp(Work), this, ERDMWorkClass::IslandRemoval, Priority);
+	}
+	else
+	{
+		DetachAnalysisTask = UE::Tasks::Launch(UE_SOURCE_LOCATION, MoveTemp(Work));
+	}
+	DetachAnalysisJob = MoveTemp(Job);
+}
+
+void URealtimeDestructibleMeshComponent::PollDetachAnalysis()
+{
+	if (!DetachAnalysisJob.IsValid() || !DetachAnalysisTask.IsCompleted())
+	{
+		return;
+	}
+
+	FlushDetachAnalysis();
+
+	// 분석 중 쌓인 시드로 다음 분석 시작
+	LaunchDetachAnalysis();
+}
+
+void URealtimeDestructibleMeshComponent::FlushDetachAnalysis()
+{
+	if (!DetachAnalysisJob.IsValid())
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_FlushDetachAnalysis);
+
+	const TSharedPtr<FDetachAnalysisJob, ESPMode::ThreadSafe> Job = MoveTemp(DetachAnalysisJob);
+	DetachAnalysisJob.Reset();
+
+	// 아직 대기 큐에 있는 작업 (화면 밖 작업은 최대 OffScreenMaxWaitSeconds까지 밀림): 기다리지 않고 취소 후 시드를 돌려놓아 호출자가 바로 탐색
+	if (!Job->Cancel())
+	{
+		DetachAnalysisTask = UE::Tasks::FTask();
+		PendingDetachSeedCells.Append(Job->SeedCells);
+		return;
+	}
+
+	DetachAnalysisTask.Wait();
+	DetachAnalysisTask = UE::Tasks::FTask();
+
+	// 실행되지 못한 작업 (종료 중 드롭, 또는 위 취소와 겹쳐 시작 직후 중단): 시드를 돌려놓음
+	if (!Job->bCompleted)
+	{
+		PendingDetachSeedCells.Append(Job->SeedCells);
+		return;
+	}
+
+	// 그리드가 다시 빌드됨 -> 결과 폐기
+	if (Job->StateEpoch != CellStateEpoch)
+	{
+		return;
+	}
+
+	// 스냅샷 이후 파괴가 있었고 분리 셀 일부가 이미 파괴됨 -> 그룹이 달라졌을 수 있으므로 폐기 후 재계산
+	// (파괴는 연결을 끊기만 하므로 분리 셀이 건드려지지 않았다면 결과는 그대로 유효)
+	if (Job->DestroyedCellCount != CellState.DestroyedCells.Num())
+	{
+		for (int32 CellId : Job->DisconnectedCells)
+		{
+			if (CellState.IsCellDestroyed(CellId))
+			{
+				UE_LOG(LogTemp, Log, TEXT("[DetachAnalysis] Stale result (%d cells), recomputing"), Job->DisconnectedCells.Num());
+				PendingDetachSeedCells.Append(Job->SeedCells);
+				return;
+			}
+		}
+	}
+
+	ApplyDetachedCells(Job->DisconnectedCells, Job->DetachedGroups);
+}
+
+void URealtimeDestructibleMeshComponent::CancelDetachAnalysis()
+{
+	PendingDetachSeedCells.Reset();
+
+	if (!DetachAnalysisJob.IsValid())
+	{
+		return;
+	}
+
+	// 시작 전이면 Run이 레이아웃/연결성을 건드리지 않고 끝나므로 기다리지 않음
+	if (DetachAnalysisJob->Cancel())
+	{
+		DetachAnalysisTask.Wait();
+	}
+	DetachAnalysisJob.Reset();
+	DetachAnalysisTask = UE::Tasks::FTask();
+}
+
 float URealtimeDestructibleMeshComponent::CalculateDebrisBoundsExtent(const TArray<int32>& CellIds) const
 {
 	if (CellIds.Num() == 0)
@@ -942,6 +1122,9 @@ void URealtimeDestructibleMeshComponent::ForceRemoveSupercell(int32 SuperCellId)
 	}
 	CellState.DestroyCells(AllCellsInSupercell);
 
+	// 셀이 모두 사라진 청크에 남은 총알 구멍 Boolean은 결과가 버려지므로 미리 취소
+	CancelBooleanWorkForEmptiedChunks(AllCellsInSupercell);
+
 	// hit count 리셋
 	SupercellState.MarkSupercellBroken(SuperCellId);
 
@@ -955,6 +1138,44 @@ void URealtimeDestructibleMeshComponent::ForceRemoveSupercell(int32 SuperCellId)
 	bPendingCleanup = true;
 }
 
+void URealtimeDestructibleMeshComponent::CancelBooleanWorkForEmptiedChunks(const TArray<int32>& RemovedCellIds)
+{
+	if (!BooleanProcessor.IsValid() || GridToChunkMap.Num() == 0)
+	{
+		return;
+	}
+
+	// 이번에 셀이 제거된 청크만 후보
+	TSet<int32> EmptiedChunks;
+	for (int32 CellId : RemovedCellIds)
+	{
+		const int32 ChunkId = GridCellIdToChunkId(CellId);
+		if (ChunkId != INDEX_NONE)
+		{
+			EmptiedChunks.Add(ChunkId);
+		}
+	}
+
+	// 살아있는 셀이 남은 청크는 후보에서 제외
+	for (int32 CellId : GridCellLayout.GetValidCellIds())
+	{
+		if (EmptiedChunks.Num() == 0)
+		{
+			return;
+		}
+
+		if (!CellState.IsCellDestroyed(CellId))
+		{
+			EmptiedChunks.Remove(GridCellIdToChunkId(CellId));
+		}
+	}
+
+	for (int32 ChunkId : EmptiedChunks)
+	{
+		BooleanProcessor->CancelChunkWork(ChunkId);
+	}
+}
+
 void URealtimeDestructibleMeshComponent::MulticastForceRemoveSupercell_Implementation(int32 SuperCellId)
 {
 	// DedicatedServer는 Pass 
@@ -998,7 +1219,13 @@ int32 URealtimeDestructibleMeshComponent::GridCellIdToChunkId(int32 GridCellId)
 	GridZ = FMath::Clamp(GridZ, 0, SliceCount.Z - 1);
 
 	const int32 GridIndex = GridX + GridY * SliceCount.X + GridZ * SliceCount.X * SliceCount.Y;
-	return GridToChunkMap.IsValidIndex(GridIndex) ? GridToChunkMap[GridIndex] : INDEX_NONE;
+	if (!GridToChunkMap.IsValidIndex(GridIndex) || GridToChunkMap[GridIndex] == INDEX_NONE)
+	{
+		return INDEX_NONE;
+	}
+
+	// 런타임에 분할된 청크면 셀 중심을 가진 조각으로
+	return ResolveSplitChunk(GridToChunkMap[GridIndex], LocalCenter);
 }
 
 //=============================================================================
@@ -1395,16 +1622,16 @@ void URealtimeDestructibleMeshComponent::BuildCollisionChunkBodySetup(int32 Chun
 
 bool URealtimeDestructibleMeshComponent::IsCellExposed(int32 CellId) const
 {
-	const FIntArray& Neighbors = GridCellLayout.GetCellNeighbors(CellId);
+	const FCellNeighborList Neighbors = GridCellLayout.GetCellNeighbors(CellId);
 
 	// 이웃이 6개 미만이면 경계 = 표면
-	if (Neighbors.Values.Num() < 6)
+	if (Neighbors.Num() < 6)
 	{
 		return true;
 	}
 
 	// 이웃 중 하나라도 파괴되었으면 표면
-	for (int32 NeighborId : Neighbors.Values)
+	for (int32 NeighborId : Neighbors)
 	{
 		if (CellState.DestroyedCells.Contains(NeighborId))
 		{
@@ -3295,6 +3522,14 @@ void URealtimeDestructibleMeshComponent::CleanupSmallFragments(const TSet<int32>
 				}
 				EditMesh.CompactInPlace();
 			});
+			const int32 ChunkIndex = GetChunkIndex(ChunkMesh);
+			// 정리 전 메시로 계산 중인 백그라운드 결과(단순화/분할)가 파편을 되살리지 않도록 세대 증가
+			if (BooleanProcessor.IsValid())
+			{
+				BooleanProcessor->BumpChunkGeneration(ChunkIndex);
+			}
+			InvalidateChunkMeshSnapshot(ChunkIndex);
+			RequestDelayedCollisionUpdate(ChunkMesh);
 			TotalRemoved++;
 		}
 	}
@@ -3544,8 +3779,8 @@ void URealtimeDestructibleMeshComponent::MulticastDestroyedCells_Implementation(
 				DirtyChunkIndices.Add(ChunkIdx);
 			}
 
-			const FIntArray& Neighbors = GridCellLayout.GetCellNeighbors(CellId);
-			for (int32 NeighborId : Neighbors.Values)
+			const FCellNeighborList Neighbors = GridCellLayout.GetCellNeighbors(CellId);
+			for (int32 NeighborId : Neighbors)
 			{
 				int32 NeighborChunkIdx = GetCollisionChunkIndexForCell(NeighborId);
 				if (NeighborChunkIdx != INDEX_NONE)
@@ -3848,70 +4083,12 @@ UDynamicMesh* URealtimeDestructibleMeshComponent::CreateToolMeshFromRequest(cons
 	return ToolMesh;
 }
 
-TSharedPtr<FDynamicMesh3, ESPMode::ThreadSafe> URealtimeDestructibleMeshComponent::CreateToolMeshPtrFromShapeParams(
+TSharedPtr<const FDynamicMesh3, ESPMode::ThreadSafe> URealtimeDestructibleMeshComponent::CreateToolMeshPtrFromShapeParams(
 	EDestructionToolShape ToolShape,
 	const FDestructionToolShapeParams& ShapeParams)
 {
-	UDynamicMesh* TempMesh = NewObject<UDynamicMesh>(this);
-	if (!TempMesh)
-	{
-		UE_LOG(LogTemp, Error, TEXT("CreateToolMeshPtrFromShapeParams: Failed to create TempMesh"));
-		return nullptr;
-	}
-
-	FGeometryScriptPrimitiveOptions PrimitiveOptions;
-	PrimitiveOptions.PolygroupMode = EGeometryScriptPrimitivePolygroupMode::SingleGroup;
-
-	switch (ToolShape)
-	{
-	case EDestructionToolShape::Sphere:
-		UGeometryScriptLibrary_MeshPrimitiveFunctions::AppendSphereLatLong(
-			TempMesh,
-			PrimitiveOptions,
-			FTransform::Identity,
-			ShapeParams.Radius,
-			ShapeParams.StepsPhi,
-			ShapeParams.StepsTheta,
-			EGeometryScriptPrimitiveOriginMode::Center
-		);
-		break;
-
-	case EDestructionToolShape::Cylinder:
-		UGeometryScriptLibrary_MeshPrimitiveFunctions::AppendCylinder(
-			TempMesh,
-			PrimitiveOptions,
-			FTransform::Identity,
-			ShapeParams.Radius,
-			ShapeParams.Height + ShapeParams.SurfaceMargin,
-			ShapeParams.RadiusSteps,
-			ShapeParams.HeightSubdivisions,
-			ShapeParams.bCapped,
-			EGeometryScriptPrimitiveOriginMode::Base
-		);
-		break;
-
-	default:
-		UGeometryScriptLibrary_MeshPrimitiveFunctions::AppendCylinder(
-			TempMesh,
-			PrimitiveOptions,
-			FTransform::Identity,
-			ShapeParams.Radius,
-			ShapeParams.Height + ShapeParams.SurfaceMargin,
-			ShapeParams.RadiusSteps,
-			ShapeParams.HeightSubdivisions,
-			ShapeParams.bCapped,
-			EGeometryScriptPrimitiveOriginMode::Base
-		);
-		break;
-	}
-
-	TSharedPtr<FDynamicMesh3, ESPMode::ThreadSafe> Result = MakeShared<FDynamicMesh3, ESPMode::ThreadSafe>();
-	TempMesh->ProcessMesh([&](const UE::Geometry::FDynamicMesh3& Source)
-		{
-			*Result = Source;
-		});
-
-	return Result;
+	// 같은 형태의 툴은 공유 템플릿을 재사용 (UObject 생성 / 프리미티브 재생성 없음)
+	return FToolMeshTemplateCache::Get().FindOrCreate(ToolShape, ShapeParams);
 }
 
 void URealtimeDestructibleMeshComponent::CopyMaterialsFromStaticMesh(UStaticMesh* InMesh)
@@ -3984,12 +4161,12 @@ void URealtimeDestructibleMeshComponent::ApplyCollisionUpdate(UDynamicMeshCompon
 		}
 		else
 		{
-			TargetComp->UpdateCollision();
+			TargetComp->UpdateCollision(false);
 			TargetComp->SetCollisionResponseToChannel(ECC_Pawn, ECR_Ignore);
 		}
 		return;
 	}
-	TargetComp->UpdateCollision();
+	TargetComp->UpdateCollision(false);
 }
 
 void URealtimeDestructibleMeshComponent::ApplyCollisionUpdateAsync(UDynamicMeshComponent* TargetComp)
@@ -4005,13 +4182,14 @@ void URealtimeDestructibleMeshComponent::ApplyCollisionUpdateAsync(UDynamicMeshC
 		}
 		else
 		{
-			TargetComp->UpdateCollision(true);
+			TargetComp->UpdateCollision(false);
 			TargetComp->SetCollisionResponseToChannel(ECC_Pawn, ECR_Ignore);
 		}
 		return;
 	}
 	UE_LOG(LogTemp, Display, TEXT("Call Collision Update %f"), FPlatformTime::Seconds());
-	TargetComp->UpdateCollision(true);
+	// 메시 편집이 렌더 갱신 지연(NoUpdate)으로 Pending 표시를 남기지 않을 수 있으므로 강제 갱신
+	TargetComp->UpdateCollision(false);
 }
 
 bool URealtimeDestructibleMeshComponent::IsChunkPenetrated(const FRealtimeDestructionRequest& Request) const
@@ -4088,6 +4266,76 @@ bool URealtimeDestructibleMeshComponent::GetChunkMesh(FDynamicMesh3& OutMesh, in
 	return false;
 }
 
+bool URealtimeDestructibleMeshComponent::AcquireChunkMeshSnapshot(int32 ChunkIndex, FChunkMeshSnapshot& OutSnapshot) const
+{
+	UDynamicMeshComponent* MeshComp = ChunkMeshComponents.IsValidIndex(ChunkIndex) ? GetChunkMeshComponent(ChunkIndex) : nullptr;
+	if (!MeshComp)
+	{
+		return false;
+	}
+
+	FScopeLock Lock(&ChunkSnapshotLock);
+
+	if (ChunkMeshSnapshots.Num() != ChunkMeshComponents.Num())
+	{
+		ChunkMeshSnapshots.SetNum(ChunkMeshComponents.Num());
+	}
+
+	FChunkMeshSnapshot& Snapshot = ChunkMeshSnapshots[ChunkIndex];
+	if (!Snapshot.IsValid())
+	{
+		// 아직 게시된 스냅샷이 없으면 청크 메시에서 한 번만 복사해서 캐싱
+		TSharedPtr<FDynamicMesh3, ESPMode::ThreadSafe> NewMesh = MakeShared<FDynamicMesh3, ESPMode::ThreadSafe>();
+		MeshComp->ProcessMesh([&](const FDynamicMesh3& Source)
+			{
+				*NewMesh = Source;
+			});
+
+		Snapshot.Mesh = MoveTemp(NewMesh);
+		Snapshot.Generation = BooleanProcessor.IsValid() ? BooleanProcessor->GetChunkGeneration(ChunkIndex) : 0;
+	}
+
+	OutSnapshot = Snapshot;
+	return true;
+}
+
+void URealtimeDestructibleMeshComponent::PublishChunkMeshSnapshot(int32 ChunkIndex, TSharedPtr<const FDynamicMesh3, ESPMode::ThreadSafe>&& Mesh, int32 Generation)
+{
+	if (!ChunkMeshComponents.IsValidIndex(ChunkIndex))
+	{
+		return;
+	}
+
+	FScopeLock Lock(&ChunkSnapshotLock);
+
+	if (ChunkMeshSnapshots.Num() != ChunkMeshComponents.Num())
+	{
+		ChunkMeshSnapshots.SetNum(ChunkMeshComponents.Num());
+	}
+
+	// 포인터 교체만 수행, 이전 버전은 마지막 워커가 해제
+	ChunkMeshSnapshots[ChunkIndex].Mesh = MoveTemp(Mesh);
+	ChunkMeshSnapshots[ChunkIndex].Generation = Generation;
+}
+
+void URealtimeDestructibleMeshComponent::InvalidateChunkMeshSnapshot(int32 ChunkIndex)
+{
+	FScopeLock Lock(&ChunkSnapshotLock);
+
+	if (ChunkMeshSnapshots.IsValidIndex(ChunkIndex))
+	{
+		ChunkMeshSnapshots[ChunkIndex] = FChunkMeshSnapshot();
+	}
+}
+
+void URealtimeDestructibleMeshComponent::InvalidateAllChunkMeshSnapshots()
+{
+	FScopeLock Lock(&ChunkSnapshotLock);
+
+	ChunkMeshSnapshots.Reset();
+	ChunkMeshSnapshots.SetNum(ChunkMeshComponents.Num());
+}
+
 bool URealtimeDestructibleMeshComponent::CheckAndSetChunkBusy(int32 ChunkIndex)
 {
 	// 비트 배열의 인덱스
@@ -4167,7 +4415,7 @@ void URealtimeDestructibleMeshComponent::FindChunksInRadius(const FVector& World
 					int32 ChunkId = GridToChunkMap[GridIndex];
 					if (ChunkId != INDEX_NONE)
 					{
-						OutChunkIndices.Add(ChunkId);
+						AppendSplitChunks(ChunkId, FBox(MinPos, MaxPos), OutChunkIndices);
 						// UniqueChunks.Add(ChunkId);
 					}
 				}
@@ -4223,6 +4471,17 @@ void URealtimeDestructibleMeshComponent::FindChunksAlongLine(const FVector& Worl
 	}
 }
 
+bool URealtimeDestructibleMeshComponent::IsChunkBusy(int32 ChunkIndex) const
+{
+	const int32 BitIndex = ChunkIndex / 64;
+	if (!ChunkBusyBits.IsValidIndex(BitIndex))
+	{
+		return true;
+	}
+
+	return (ChunkBusyBits[BitIndex] & (1ULL << (ChunkIndex % 64))) != 0;
+}
+
 void URealtimeDestructibleMeshComponent::ClearChunkBusy(int32 ChunkIndex)
 {
 	const int32 BitIndex = ChunkIndex / 64;
@@ -4278,10 +4537,12 @@ void URealtimeDestructibleMeshComponent::ApplyBooleanOperationResult(FDynamicMes
 		return;
 	}
 
+	// 메시 데이터만 교체하고 렌더 버퍼 재구성은 청크별로 모아서 Tick에서 처리
 	TargetComp->EditMesh([&](FDynamicMesh3& InternalMesh)
 		{
 			InternalMesh = MoveTemp(NewMesh);
-		});
+		}, EDynamicMeshComponentRenderUpdateMode::NoUpdate);
+	RequestChunkRenderUpdate(ChunkIndex);
 
 	// 수정된 청크 추적
 	ModifiedChunkIds.Add(ChunkIndex);
@@ -4388,6 +4649,49 @@ void URealtimeDestructibleMeshComponent::OnBooleanBatchCompleted(int32 BatchId)
 	CleanupSmallFragments();
 }
 
+void URealtimeDestructibleMeshComponent::RequestChunkRenderUpdate(int32 ChunkIndex)
+{
+	if (!IsChunkValid(ChunkIndex))
+	{
+		return;
+	}
+
+	PendingRenderUpdateChunks.Add(ChunkIndex);
+}
+
+void URealtimeDestructibleMeshComponent::FlushChunkRenderUpdates(bool bForce)
+{
+	if (PendingRenderUpdateChunks.Num() == 0)
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(RDM_FlushChunkRenderUpdates);
+
+	UWorld* World = GetWorld();
+	const double Now = World ? World->GetTimeSeconds() : 0.0;
+
+	for (auto It = PendingRenderUpdateChunks.CreateIterator(); It; ++It)
+	{
+		const int32 ChunkIndex = *It;
+
+		// 최소 간격이 지나지 않은 청크는 다음 Tick으로 이월 (그 사이 결과들이 한 번의 재구성으로 합쳐짐)
+		const double* LastUpdateTime = ChunkRenderUpdateTimes.Find(ChunkIndex);
+		if (!bForce && LastUpdateTime && Now - *LastUpdateTime < RenderUpdateMinInterval)
+		{
+			continue;
+		}
+
+		if (UDynamicMeshComponent* ChunkComp = GetChunkMeshComponent(ChunkIndex))
+		{
+			ChunkComp->NotifyMeshUpdated();
+		}
+
+		ChunkRenderUpdateTimes.Add(ChunkIndex, Now);
+		It.RemoveCurrent();
+	}
+}
+
 void URealtimeDestructibleMeshComponent::RequestDelayedCollisionUpdate(UDynamicMeshComponent* TargetComp)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(Debris_Collision_RequestDelayed);
@@ -4395,18 +4699,63 @@ void URealtimeDestructibleMeshComponent::RequestDelayedCollisionUpdate(UDynamicM
 	{
 		return;
 	}
-	// InRate 이내에 호출되는 경우 타이머 리셋
-	if (UWorld* World = GetWorld())
+
+	UWorld* World = GetWorld();
+	if (!World)
 	{
-		FTimerDelegate CollsionTimerDelegate;
-		CollsionTimerDelegate.BindUObject(this, &URealtimeDestructibleMeshComponent::ApplyCollisionUpdateAsync, TargetComp);
-		UE_LOG(LogTemp, Display, TEXT("Set Collision Timer %f"), FPlatformTime::Seconds());
-		World->GetTimerManager().SetTimer(
-			CollisionUpdateTimerHandle,
-			CollsionTimerDelegate,			
-			0.05f,
-			false);
+		return;
 	}
+
+	// 청크별 디바운스: 한 청크의 갱신 요청이 다른 청크의 타이머를 리셋하지 않음
+	const int32 ChunkIndex = GetChunkIndex(TargetComp);
+	const double Now = World->GetTimeSeconds();
+
+	FTimerManager& TimerManager = World->GetTimerManager();
+	FTimerHandle& TimerHandle = ChunkCollisionTimerHandles.FindOrAdd(ChunkIndex);
+	const double FirstRequestTime = ChunkCollisionFirstRequestTimes.FindOrAdd(ChunkIndex, Now);
+
+	// 계속 피격 중인 청크도 MaxDelay 안에는 갱신되도록 한도를 넘기면 타이머를 리셋하지 않음
+	if (TimerManager.IsTimerActive(TimerHandle) && Now - FirstRequestTime >= CollisionUpdateMaxDelay)
+	{
+		return;
+	}
+
+	FTimerDelegate CollisionTimerDelegate;
+	CollisionTimerDelegate.BindUObject(this, &URealtimeDestructibleMeshComponent::OnChunkCollisionTimer, ChunkIndex);
+	TimerManager.SetTimer(
+		TimerHandle,
+		CollisionTimerDelegate,
+		FMath::Max(CollisionUpdateDelay, KINDA_SMALL_NUMBER),
+		false);
+}
+
+void URealtimeDestructibleMeshComponent::OnChunkCollisionTimer(int32 ChunkIndex)
+{
+	ChunkCollisionFirstRequestTimes.Remove(ChunkIndex);
+
+	// INDEX_NONE = 청크가 아닌 자기 자신(단일 메시 모드)
+	UDynamicMeshComponent* TargetComp = (ChunkIndex == INDEX_NONE) ? this : GetChunkMeshComponent(ChunkIndex);
+	if (TargetComp)
+	{
+		ApplyCollisionUpdateAsync(TargetComp);
+	}
+}
+
+void URealtimeDestructibleMeshComponent::ConfigureChunkCollisionCooking(UDynamicMeshComponent* ChunkComp) const
+{
+	if (!ChunkComp)
+	{
+		return;
+	}
+
+	/*
+	 * 메시 편집 시 즉시 GameThread에서 쿠킹하지 않고 Pending으로만 표시,
+	 * 실제 갱신은 청크별 디바운스 타이머에서 UpdateCollision으로 수행.
+	 * Async 쿠킹 시 새 BodySetup에 백그라운드로 쿠킹 후 완료 시점에 교체되므로
+	 * 쿠킹 중에도 기존 콜리전이 유지됨.
+	 */
+	ChunkComp->bUseAsyncCooking = bAsyncChunkCollisionCooking;
+	ChunkComp->SetDeferredCollisionUpdatesEnabled(true, false);
 }
 
 void URealtimeDestructibleMeshComponent::UpdateDebugText()
@@ -5034,6 +5383,20 @@ void URealtimeDestructibleMeshComponent::BeginPlay()
 	ChunkBusyBits.Init(0ULL, NumBits);
 	ChunkSubtractBusyBits.Init(0ULL, NumBits);
 
+	// 런타임 청크 분할로 추가될 자리를 미리 확보 (워커가 읽는 중에 배열이 재할당되면 안 됨)
+	const URDMSetting* SplitSetting = URDMSetting::Get();
+	if (SplitSetting && SplitSetting->bEnableRuntimeChunkSplit)
+	{
+		ChunkMeshComponents.Reserve(ChunkMeshComponents.Num() + FMath::Max(0, SplitSetting->MaxRuntimeSplitChunks));
+	}
+
+	InvalidateAllChunkMeshSnapshots();
+
+	for (UDynamicMeshComponent* ChunkComp : ChunkMeshComponents)
+	{
+		ConfigureChunkCollisionCooking(ChunkComp);
+	}
+
 	FVector CurrentScale = GetComponentTransform().GetScale3D();
 	const bool bIsLayoutValid = GridCellLayout.IsValid();
 	const bool bScaleMisMatch = bIsLayoutValid ? !GridCellLayout.MeshScale.Equals(CurrentScale, 1.e-4f) : true;	
@@ -5096,6 +5459,9 @@ void URealtimeDestructibleMeshComponent::TickComponent(float DeltaTime, ELevelTi
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
+	// 워커에서 끝난 분리 분석 결과 적용
+	PollDetachAnalysis();
+
 	UWorld* World = GetWorld();
 	if (bPendingCleanup && World && World->GetNetMode() == NM_Standalone )
 	{
@@ -5119,11 +5485,26 @@ void URealtimeDestructibleMeshComponent::TickComponent(float DeltaTime, ELevelTi
 
 	if (BooleanProcessor.IsValid() && GetChunkNum() > 0)
 	{
+		// 완료된 Boolean 결과를 프레임 예산 내에서 적용 (초과분은 다음 프레임으로 이월)
+		// 적용 중 Processor가 교체될 수 있으므로 로컬 참조 유지
+		TSharedPtr<FRealtimeBooleanProcessor, ESPMode::ThreadSafe> Processor = BooleanProcessor;
+		const URDMSetting* Setting = URDMSetting::Get();
+		Processor->DrainCompletionQueue(Setting ? Setting->ResultApplyBudgetMs : 0.0);
+
 		// 매틱 Subtract Queue를 비워준다.
 		//BooleanProcessor->KickProcessIfNeeded();
-		BooleanProcessor->KickProcessIfNeededPerChunk();
+		if (BooleanProcessor.IsValid())
+		{
+			BooleanProcessor->KickProcessIfNeededPerChunk();
+		}
+
+		// 비용 초과 청크 중 작업이 빈 청크를 분할
+		ProcessPendingChunkSplits();
 	}
 
+	// 이번 프레임에 적용된 결과들의 렌더 버퍼 재구성 (청크당 1회)
+	FlushChunkRenderUpdates();
+
 	// GridCell 디버그 표시
 	if (bShowGridCellDebug)
 	{
@@ -5214,6 +5595,8 @@ void URealtimeDestructibleMeshComponent::OnUnregister()
 
 void URealtimeDestructibleMeshComponent::BeginDestroy()
 {
+	CancelDetachAnalysis();
+
 	if (BooleanProcessor.IsValid())
 	{
 		BooleanProcessor->Shutdown();
@@ -5224,12 +5607,27 @@ void URealtimeDestructibleMeshComponent::BeginDestroy()
 
 void URealtimeDestructibleMeshComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	CancelDetachAnalysis();
+
 	if (BooleanProcessor.IsValid())
 	{
 		BooleanProcessor->Shutdown();
 		BooleanProcessor.Reset();
 	}
 
+	if (UWorld* World = GetWorld())
+	{
+		for (TPair<int32, FTimerHandle>& Pair : ChunkCollisionTimerHandles)
+		{
+			World->GetTimerManager().ClearTimer(Pair.Value);
+		}
+	}
+	ChunkCollisionTimerHandles.Reset();
+	ChunkCollisionFirstRequestTimes.Reset();
+
+	PendingChunkSplits.Reset();
+	SplittingChunkIndex = INDEX_NONE;
+
 	Super::EndPlay(EndPlayReason);
 }
 
@@ -6083,6 +6481,294 @@ void URealtimeDestructibleMeshComponent::BuildGridToChunkMap()
 	UE_LOG(LogTemp, Log, TEXT("BuildGridToChunkMap: Built map for %d grid cells"), ExpectedChunkCount);
 }
 
+void URealtimeDestructibleMeshComponent::RequestChunkSplit(int32 ChunkIndex)
+{
+	// 청크 인덱스가 네트워크로 전달되므로 토폴로지 변경은 스탠드얼론에서만 허용
+	UWorld* World = GetWorld();
+	if (!World || World->GetNetMode() != NM_Standalone)
+	{
+		return;
+	}
+
+	if (!ChunkMeshComponents.IsValidIndex(ChunkIndex) || ChunkIndex == SplittingChunkIndex || UnsplittableChunks.Contains(ChunkIndex))
+	{
+		return;
+	}
+
+	PendingChunkSplits.Add(ChunkIndex);
+}
+
+int32 URealtimeDestructibleMeshComponent::ResolveSplitChunk(int32 ChunkIndex, const FVector& LocalPosition) const
+{
+	int32 Current = ChunkIndex;
+	while (const TArray<int32>* Children = ChunkSplitChildren.Find(Current))
+	{
+		int32 Next = Current;
+		for (const int32 Child : *Children)
+		{
+			if (ChunkSplitRegions.IsValidIndex(Child) && ChunkSplitRegions[Child].IsInsideOrOn(LocalPosition))
+			{
+				Next = Child;
+				break;
+			}
+		}
+
+		// 자식 영역 밖이면 분할 후 남은 조각(자기 자신)이 소유
+		if (Next == Current)
+		{
+			break;
+		}
+		Current = Next;
+	}
+
+	return Current;
+}
+
+void URealtimeDestructibleMeshComponent::AppendSplitChunks(int32 ChunkIndex, const FBox& LocalBounds, TArray<int32>& OutChunkIndices) const
+{
+	const TArray<int32>* Children = ChunkSplitChildren.Find(ChunkIndex);
+	const bool bHasRegion = ChunkSplitRegions.IsValidIndex(ChunkIndex) && ChunkSplitRegions[ChunkIndex].IsValid;
+	if (!Children && !bHasRegion)
+	{
+		OutChunkIndices.Add(ChunkIndex);
+		return;
+	}
+
+	if (!bHasRegion || ChunkSplitRegions[ChunkIndex].Intersect(LocalBounds))
+	{
+		OutChunkIndices.Add(ChunkIndex);
+	}
+
+	if (Children)
+	{
+		for (const int32 Child : *Children)
+		{
+			AppendSplitChunks(Child, LocalBounds, OutChunkIndices);
+		}
+	}
+}
+
+void URealtimeDestructibleMeshComponent::ProcessPendingChunkSplits()
+{
+	// 분할은 한 번에 하나씩, 섬 제거가 진행 중이면 대기 (청크 라우팅이 바뀌면 안 됨)
+	if (PendingChunkSplits.Num() == 0 || SplittingChunkIndex != INDEX_NONE || !BooleanProcessor.IsValid() ||
+		ActiveIslandRemovalCount.load() > 0)
+	{
+		return;
+	}
+
+	for (auto It = PendingChunkSplits.CreateIterator(); It; ++It)
+	{
+		const int32 ChunkIndex = *It;
+		UDynamicMeshComponent* ChunkComp = ChunkMeshComponents.IsValidIndex(ChunkIndex) ? ChunkMeshComponents[ChunkIndex].Get() : nullptr;
+		if (!ChunkComp || UnsplittableChunks.Contains(ChunkIndex))
+		{
+			It.RemoveCurrent();
+			continue;
+		}
+
+		// 대기/진행 중인 Boolean이 끝날 때까지 보류
+		if (!BooleanProcessor->IsChunkIdle(ChunkIndex))
+		{
+			continue;
+		}
+		It.RemoveCurrent();
+
+		// 분할된 적 없는 청크는 메시 바운드 전체가 영역
+		FBox Region = ChunkSplitRegions.IsValidIndex(ChunkIndex) ? ChunkSplitRegions[ChunkIndex] : FBox(ForceInit);
+		if (!Region.IsValid)
+		{
+			Region = ChunkComp->Bounds.GetBox().InverseTransformBy(GetComponentTransform());
+		}
+
+		FChunkSplitter::FPlan Plan;
+		if (!FChunkSplitter::BuildPlan(Region, GridCellLayout, Plan))
+		{
+			UnsplittableChunks.Add(ChunkIndex);
+			continue;
+		}
+
+		// 프로세서의 청크별 상태와 예약된 컴포넌트 배열 범위 안에서만 추가
+		const int32 ChunkCapacity = FMath::Min(BooleanProcessor->GetChunkCapacity(), ChunkMeshComponents.Max());
+		if (ChunkMeshComponents.Num() + Plan.GetMaxPartCount() - 1 > ChunkCapacity)
+		{
+			UE_LOG(LogTemp, Log, TEXT("[ChunkSplit] Chunk %d: split budget exhausted (%d/%d chunks)"),
+				ChunkIndex, ChunkMeshComponents.Num(), ChunkCapacity);
+			UnsplittableChunks.Add(ChunkIndex);
+			continue;
+		}
+
+		FChunkMeshSnapshot Snapshot;
+		if (!AcquireChunkMeshSnapshot(ChunkIndex, Snapshot))
+		{
+			continue;
+		}
+
+		// 계산 동안 새 Subtract가 시작되지 않고 요청은 버킷에 머무르도록 잡아둔다
+		CheckAndSetChunkBusy(ChunkIndex);
+		BooleanProcessor->SetChunkSplitInFlight(ChunkIndex, true);
+		SplittingChunkIndex = ChunkIndex;
+
+		const FTransform ChunkToOwner = ChunkComp->GetComponentTransform().GetRelativeTransform(GetComponentTransform());
+		TWeakObjectPtr<URealtimeDestructibleMeshComponent> WeakThis(this);
+
+		UE::Tasks::Launch(
+			UE_SOURCE_LOCATION,
+			[WeakThis, ChunkIndex, Snapshot, ChunkToOwner, Region, Plan]()
+			{
+				TArray<FChunkSplitter::FPart> Parts;
+				FChunkSplitter::SplitMesh(*Snapshot.Mesh, ChunkToOwner, Region, Plan, Parts);
+
+				AsyncTask(ENamedThreads::GameThread, [WeakThis, ChunkIndex, SourceGeneration = Snapshot.Generation, Parts = MoveTemp(Parts)]() mutable
+				{
+					if (URealtimeDestructibleMeshComponent* Owner = WeakThis.Get())
+					{
+						Owner->FinishChunkSplit(ChunkIndex, SourceGeneration, MoveTemp(Parts));
+					}
+				});
+			});
+		return;
+	}
+}
+
+void URealtimeDestructibleMeshComponent::FinishChunkSplit(int32 ChunkIndex, int32 SourceGeneration, TArray<FChunkSplitter::FPart>&& Parts)
+{
+	if (SplittingChunkIndex != ChunkIndex)
+	{
+		return;
+	}
+	SplittingChunkIndex = INDEX_NONE;
+
+	if (!BooleanProcessor.IsValid())
+	{
+		return;
+	}
+	ClearChunkBusy(ChunkIndex);
+	BooleanProcessor->SetChunkSplitInFlight(ChunkIndex, false);
+
+	UDynamicMeshComponent* SourceChunk = GetChunkMeshComponent(ChunkIndex);
+	if (!SourceChunk)
+	{
+		return;
+	}
+
+	// 계산 중에 메시가 바뀌었으면 버리고 다음 비용 초과 보고 때 다시 시도
+	// (불리언 적용과 파편 정리 모두 BumpChunkGeneration으로 세대를 올림)
+	if (BooleanProcessor->GetChunkGeneration(ChunkIndex) != SourceGeneration)
+	{
+		UE_LOG(LogTemp, Log, TEXT("[ChunkSplit] Chunk %d changed during split, discarded"), ChunkIndex);
+		return;
+	}
+
+	if (Parts.Num() < 2)
+	{
+		UnsplittableChunks.Add(ChunkIndex);
+		return;
+	}
+
+#if !UE_BUILD_SHIPPING
+	TRACE_CPUPROFILER_EVENT_SCOPE("FinishChunkSplit");
+#endif
+
+	// 컴포넌트를 모두 만든 뒤에 메시를 옮긴다 (중간 실패 시 원본 유지)
+	TArray<UDynamicMeshComponent*> NewChunks;
+	for (int32 PartIndex = 1; PartIndex < Parts.Num(); ++PartIndex)
+	{
+		UDynamicMeshComponent* NewChunk = CreateSplitChunkComponent(SourceChunk, ChunkMeshComponents.Num() + NewChunks.Num());
+		if (!NewChunk)
+		{
+			for (UDynamicMeshComponent* Created : NewChunks)
+			{
+				Created->DestroyComponent();
+			}
+			return;
+		}
+		NewChunks.Add(NewChunk);
+	}
+
+	TArray<int32> NewChunkIndices;
+	for (UDynamicMeshComponent* NewChunk : NewChunks)
+	{
+		const int32 NewChunkIndex = ChunkMeshComponents.Add(NewChunk);
+		ChunkIndexMap.Add(NewChunk, NewChunkIndex);
+		NewChunkIndices.Add(NewChunkIndex);
+	}
+
+	const int32 NumBits = (ChunkMeshComponents.Num() + 63) / 64;
+	ChunkBusyBits.SetNumZeroed(NumBits);
+	ChunkSubtractBusyBits.SetNumZeroed(NumBits);
+
+	while (ChunkSplitRegions.Num() < ChunkMeshComponents.Num())
+	{
+		ChunkSplitRegions.Add(FBox(ForceInit));
+	}
+	ChunkSplitRegions[ChunkIndex] = Parts[0].Region;
+	for (int32 i = 0; i < NewChunkIndices.Num(); ++i)
+	{
+		ChunkSplitRegions[NewChunkIndices[i]] = Parts[i + 1].Region;
+	}
+	ChunkSplitChildren.FindOrAdd(ChunkIndex).Append(NewChunkIndices);
+
+	// 원본 청크는 첫 조각을 유지, 나머지는 새 청크로
+	ApplyBooleanOperationResult(MoveTemp(Parts[0].Mesh), ChunkIndex, true);
+	for (int32 i = 0; i < NewChunkIndices.Num(); ++i)
+	{
+		ApplyBooleanOperationResult(MoveTemp(Parts[i + 1].Mesh), NewChunkIndices[i], true);
+	}
+
+	// 청크별 상태 초기화 + 대기 중이던 요청을 새 조각으로 재배치
+	BooleanProcessor->OnChunkSplit(ChunkIndex, NewChunkIndices);
+
+	InvalidateChunkMeshSnapshot(ChunkIndex);
+	for (const int32 NewChunkIndex : NewChunkIndices)
+	{
+		InvalidateChunkMeshSnapshot(NewChunkIndex);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[ChunkSplit] Chunk %d split into %d parts (%d chunks)"),
+		ChunkIndex, Parts.Num(), ChunkMeshComponents.Num());
+}
+
+UDynamicMeshComponent* URealtimeDestructibleMeshComponent::CreateSplitChunkComponent(UDynamicMeshComponent* SourceChunk, int32 NewChunkIndex)
+{
+	AActor* Owner = GetOwner();
+	if (!Owner || !SourceChunk)
+	{
+		return nullptr;
+	}
+
+	// 런타임 전용 컴포넌트 (저장되지 않음)
+	UDynamicMeshComponent* NewChunk = NewObject<UDynamicMeshComponent>(
+		Owner,
+		UDynamicMeshComponent::StaticClass(),
+		MakeUniqueObjectName(Owner, UDynamicMeshComponent::StaticClass(), *FString::Printf(TEXT("Chunk_%d"), NewChunkIndex)),
+		RF_Transient
+	);
+
+	if (!NewChunk)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[ChunkSplit] Failed to create chunk component %d"), NewChunkIndex);
+		return nullptr;
+	}
+
+	// 원본 청크와 같은 로컬 공간을 쓰도록 같은 부모, 같은 상대 트랜스폼
+	NewChunk->SetupAttachment(SourceChunk->GetAttachParent(), SourceChunk->GetAttachSocketName());
+	NewChunk->SetRelativeTransform(SourceChunk->GetRelativeTransform());
+
+	NewChunk->SetCollisionEnabled(SourceChunk->GetCollisionEnabled());
+	NewChunk->SetCollisionProfileName(SourceChunk->GetCollisionProfileName());
+	NewChunk->SetCollisionResponseToChannels(SourceChunk->GetCollisionResponseToChannels());
+	NewChunk->SetComplexAsSimpleCollisionEnabled(true);
+
+	NewChunk->PrimaryComponentTick.bCanEverTick = false;
+	NewChunk->ConfigureMaterialSet(SourceChunk->GetMaterials());
+	ConfigureChunkCollisionCooking(NewChunk);
+
+	NewChunk->RegisterComponent();
+
+	return NewChunk;
+}
+
 bool URealtimeDestructibleMeshComponent::BuildGridCells()
 {
 	// 1. SourceStaticMesh 확인
@@ -6132,6 +6818,10 @@ bool URealtimeDestructibleMeshComponent::BuildGridCells()
 			&& SavedGridSize.Y > 0
 			&& SavedGridSize.Z > 0;
 
+	// 워커가 GridCellLayout을 읽는 중일 수 있으므로 먼저 분석 취소
+	CancelDetachAnalysis();
+	++CellStateEpoch;
+
 	GridCellLayout.Reset();
 	CellState.Reset();
 
@@ -6187,6 +6877,10 @@ bool URealtimeDestructibleMeshComponent::BuildGridCells()
 	
 	// 5. SuperCell 상태 빌드 (BFS 최적화용)
 	SupercellState.BuildFromGridLayout(GridCellLayout);
+	IncrementalConnectivity.Invalidate();
+
+	// 6. CellState 밀집 저장소를 그리드 크기에 맞춤 (파괴 비트셋, SubCell 마스크)
+	CellState.InitializeForLayout(GridCellLayout);
 
 #if WITH_EDITOR
 	if (GetWorld() && !GetWorld()->IsGameWorld())
@@ -6211,6 +6905,7 @@ void URealtimeDestructibleMeshComponent::FindChunksAlongLineInternal(const FVect
 	// World to Local
 	FVector LocalStart = GetComponentTransform().InverseTransformPosition(WorldStart);
 	FVector LocalEnd = GetComponentTransform().InverseTransformPosition(WorldEnd);
+	const FBox LocalLineBounds(LocalStart.ComponentMin(LocalEnd), LocalStart.ComponentMax(LocalEnd));
 
 	/*
 	 * Slab method로 라인이 메시 내부에 있는 지 검사할 필요가 없음
@@ -6274,7 +6969,7 @@ void URealtimeDestructibleMeshComponent::FindChunksAlongLineInternal(const FVect
 				int32 ChunkIndex = GridToChunkMap[GridIndex];
 				if (ChunkIndex != INDEX_NONE)
 				{
-					OutChunkIndices.Add(ChunkIndex);
+					AppendSplitChunks(ChunkIndex, LocalLineBounds, OutChunkIndices);
 				}
 			}
 		}
@@ -18,6 +18,16 @@ URDMSetting::URDMSetting()
 
 	MaxThreadCount = 8;
 	ThreadPercentage = 50;
+	ResultApplyBudgetMs = 4.0f;
+	BooleanRequestQueueCapacity = 2048;
+	UnionWorkerCapPercentage = 75;
+	SubtractWorkerCapPercentage = 100;
+	IslandRemovalWorkerCapPercentage = 50;
+	SimplifyWorkerCapPercentage = 25;
+	OffScreenMaxWaitSeconds = 0.5f;
+	bEnableRuntimeChunkSplit = true;
+	ChunkSplitTriangleCount = 150000;
+	MaxRuntimeSplitChunks = 64;
 }
 
 URDMSetting* URDMSetting::Get()
@@ -72,7 +72,7 @@ TArray<int32> FCellDestructionSystem::ProcessCellDestruction(
 	const FGridCellLayout& GridLayout,
 	const FQuantizedDestructionInput& Shape,
 	const FTransform& MeshTransform,
-	const TSet<int32>& DestroyedCells)
+	const FCellBitSet& DestroyedCells)
 {
 	TArray<int32> NewlyDestroyed;
 
@@ -150,6 +150,11 @@ TSet<int32> FCellDestructionSystem::FindDisconnectedCells(
 	bool bEnableSubcell,
 	FConnectivityContext& Context)
 {
+	// Without subcell boundaries, connectivity is plain cell adjacency: use the word-parallel kernel
+	if (!bEnableSubcell)
+	{
+		return FindDisconnectedCellsWordParallel(GridLayout, CellState.DestroyedCells);
+	}
 	if (bEnableSupercell)
 	{
 		return FindDisconnectedCellsHierarchicalLevel(
@@ -159,18 +164,229 @@ TSet<int32> FCellDestructionSystem::FindDisconnectedCells(
 			bEnableSubcell,
 			Context);
 	}
-	if (bEnableSubcell)
+	return FindDisconnectedCellsSubCellLevel(
+		GridLayout,
+		CellState);
+}
+
+//=============================================================================
+// FCellDestructionSystem - Word-parallel cell connectivity (64 cells per word)
+//=============================================================================
+
+namespace WordParallelConnectivityHelper
+{
+	/** Read NumBits (<= 64) starting at BitOffset from a linear uint32 bitfield (missing words read as 0). */
+	FORCEINLINE uint64 ReadBits(const TArray<uint32>& Words, int64 BitOffset, int32 NumBits)
 	{
-		return FindDisconnectedCellsSubCellLevel(
-			GridLayout,
-			CellState);
+		const int64 FirstWord = BitOffset >> 5;
+		const int32 Shift = static_cast<int32>(BitOffset & 31);
+
+		// Any 64-bit window spans at most 3 source words
+		uint64 Value = 0;
+		for (int32 i = 0; i < 3; ++i)
+		{
+			const int64 WordIndex = FirstWord + i;
+			const int32 DestShift = i * 32 - Shift;
+			if (WordIndex >= Words.Num() || DestShift >= 64)
+			{
+				break;
+			}
+
+			const uint64 Word = Words[WordIndex];
+			Value |= DestShift >= 0 ? (Word << DestShift) : (Word >> -DestShift);
+		}
+
+		return NumBits < 64 ? (Value & ((1ull << NumBits) - 1)) : Value;
+	}
+
+	/** Occluded fill toward higher bits: spread Seeds through the runs of Mask containing them. */
+	FORCEINLINE uint64 FillUp(uint64 Seeds, uint64 Mask)
+	{
+		Seeds |= Mask & (Seeds << 1);
+		Mask &= Mask << 1;
+		Seeds |= Mask & (Seeds << 2);
+		Mask &= Mask << 2;
+		Seeds |= Mask & (Seeds << 4);
+		Mask &= Mask << 4;
+		Seeds |= Mask & (Seeds << 8);
+		Mask &= Mask << 8;
+		Seeds |= Mask & (Seeds << 16);
+		Mask &= Mask << 16;
+		Seeds |= Mask & (Seeds << 32);
+		return Seeds;
+	}
+
+	/** Occluded fill toward lower bits. */
+	FORCEINLINE uint64 FillDown(uint64 Seeds, uint64 Mask)
+	{
+		Seeds |= Mask & (Seeds >> 1);
+		Mask &= Mask >> 1;
+		Seeds |= Mask & (Seeds >> 2);
+		Mask &= Mask >> 2;
+		Seeds |= Mask & (Seeds >> 4);
+		Mask &= Mask >> 4;
+		Seeds |= Mask & (Seeds >> 8);
+		Mask &= Mask >> 8;
+		Seeds |= Mask & (Seeds >> 16);
+		Mask &= Mask >> 16;
+		Seeds |= Mask & (Seeds >> 32);
+		return Seeds;
+	}
+
+	/**
+	 * Spread reached bits along X through the passable runs of one row.
+	 * An upward pass then a downward pass (carrying across word boundaries) fills every seeded run.
+	 */
+	FORCEINLINE void FillRow(uint64* Reached, const uint64* Passable, int32 WordsPerRow)
+	{
+		uint64 Carry = 0;
+		for (int32 Word = 0; Word < WordsPerRow; ++Word)
+		{
+			Reached[Word] = FillUp(Reached[Word] | (Carry & Passable[Word]), Passable[Word]);
+			Carry = Reached[Word] >> 63;
+		}
+
+		Carry = 0;
+		for (int32 Word = WordsPerRow - 1; Word >= 0; --Word)
+		{
+			Reached[Word] = FillDown(Reached[Word] | ((Carry << 63) & Passable[Word]), Passable[Word]);
+			Carry = Reached[Word] & 1;
+		}
+	}
+}
+
+TSet<int32> FCellDestructionSystem::FindDisconnectedCellsWordParallel(
+	const FGridCellLayout& GridLayout,
+	const FCellBitSet& DestroyedCells)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_FindDisconnectedCellsWordParallel);
+	using namespace WordParallelConnectivityHelper;
+
+	TSet<int32> Disconnected;
+
+	const int32 SizeX = GridLayout.GridSize.X;
+	const int32 SizeY = GridLayout.GridSize.Y;
+	const int32 SizeZ = GridLayout.GridSize.Z;
+	if (SizeX <= 0 || SizeY <= 0 || SizeZ <= 0)
+	{
+		return Disconnected;
+	}
+
+	// Row = one X line of the grid: CellId = X + Row * SizeX, Row = Y + Z * SizeY
+	const int32 NumRows = SizeY * SizeZ;
+	const int32 WordsPerRow = (SizeX + 63) >> 6;
+
+	TArray<uint64> Passable;
+	TArray<uint64> Reached;
+	Passable.SetNumUninitialized(NumRows * WordsPerRow);
+	Reached.SetNumUninitialized(NumRows * WordsPerRow);
+
+	TArray<int32> DirtyRows;
+	TArray<uint8> RowQueued;
+	RowQueued.SetNumZeroed(NumRows);
+
+	// 1. Repack linear bitfields into row-aligned words; seed rows that hold an alive anchor
+	for (int32 Row = 0; Row < NumRows; ++Row)
+	{
+		const int64 RowStart = static_cast<int64>(Row) * SizeX;
+		uint64* RowReached = &Reached[Row * WordsPerRow];
+		uint64* RowPassable = &Passable[Row * WordsPerRow];
+		bool bSeeded = false;
+
+		for (int32 Word = 0; Word < WordsPerRow; ++Word)
+		{
+			const int64 BitOffset = RowStart + Word * 64;
+			const int32 NumBits = FMath::Min(64, SizeX - Word * 64);
+
+			const uint64 Exists = ReadBits(GridLayout.CellExistsBits, BitOffset, NumBits);
+			const uint64 Destroyed = ReadBits(DestroyedCells.Words, BitOffset, NumBits);
+			const uint64 Anchors = ReadBits(GridLayout.CellIsAnchorBits, BitOffset, NumBits);
+
+			RowPassable[Word] = Exists & ~Destroyed;
+			RowReached[Word] = RowPassable[Word] & Anchors;
+			bSeeded |= RowReached[Word] != 0;
+		}
+
+		if (bSeeded)
+		{
+			FillRow(RowReached, RowPassable, WordsPerRow);
+			DirtyRows.Add(Row);
+			RowQueued[Row] = 1;
+		}
+	}
+
+	// 2. Propagate along Y/Z as row-word ORs until no row grows (fixpoint)
+	while (DirtyRows.Num() > 0)
+	{
+		const int32 Row = DirtyRows.Pop(EAllowShrinking::No);
+		RowQueued[Row] = 0;
+
+		const int32 Y = Row % SizeY;
+		const int32 Z = Row / SizeY;
+		const uint64* SourceReached = &Reached[Row * WordsPerRow];
+
+		const int32 NeighborRows[4] = {
+			Y > 0 ? Row - 1 : INDEX_NONE,
+			Y < SizeY - 1 ? Row + 1 : INDEX_NONE,
+			Z > 0 ? Row - SizeY : INDEX_NONE,
+			Z < SizeZ - 1 ? Row + SizeY : INDEX_NONE
+		};
+
+		for (const int32 NeighborRow : NeighborRows)
+		{
+			if (NeighborRow == INDEX_NONE)
+			{
+				continue;
+			}
+
+			uint64* TargetReached = &Reached[NeighborRow * WordsPerRow];
+			const uint64* TargetPassable = &Passable[NeighborRow * WordsPerRow];
+
+			bool bGrew = false;
+			for (int32 Word = 0; Word < WordsPerRow; ++Word)
+			{
+				const uint64 NewBits = SourceReached[Word] & TargetPassable[Word] & ~TargetReached[Word];
+				if (NewBits != 0)
+				{
+					TargetReached[Word] |= NewBits;
+					bGrew = true;
+				}
+			}
+
+			if (bGrew)
+			{
+				FillRow(TargetReached, TargetPassable, WordsPerRow);
+				if (!RowQueued[NeighborRow])
+				{
+					RowQueued[NeighborRow] = 1;
+					DirtyRows.Add(NeighborRow);
+				}
+			}
+		}
 	}
-	return FindDisconnectedCellsCellLevel(GridLayout, CellState.DestroyedCells);
+
+	// 3. Passable but unreached cells are detached
+	for (int32 Row = 0; Row < NumRows; ++Row)
+	{
+		for (int32 Word = 0; Word < WordsPerRow; ++Word)
+		{
+			const int32 Index = Row * WordsPerRow + Word;
+			uint64 Unreached = Passable[Index] & ~Reached[Index];
+			while (Unreached != 0)
+			{
+				const int32 Bit = static_cast<int32>(FMath::CountTrailingZeros64(Unreached));
+				Disconnected.Add(Row * SizeX + Word * 64 + Bit);
+				Unreached &= Unreached - 1;
+			}
+		}
+	}
+
+	return Disconnected;
 }
 
 TSet<int32> FCellDestructionSystem::FindDisconnectedCellsCellLevel(
 	const FGridCellLayout& GridLayout,
-	const TSet<int32>& DestroyedCells)
+	const FCellBitSet& DestroyedCells)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_FindDisconnectedCellsCellLevel)
 	TSet<int32> Connected;
@@ -233,7 +449,7 @@ TSet<int32> FCellDestructionSystem::FindDisconnectedCellsCellLevel(
 TArray<TArray<int32>> FCellDestructionSystem::GroupDetachedCells(
 	const FGridCellLayout& GridLayout,
 	const TSet<int32>& DisconnectedCells,
-	const TSet<int32>& DestroyedCells)
+	const FCellBitSet& DestroyedCells)
 {
 	TArray<TArray<int32>> Groups;
 	TSet<int32> Visited;
@@ -335,7 +551,7 @@ FVector FCellDestructionSystem::CalculateDebrisVelocity(
 bool FCellDestructionSystem::IsBoundaryCell(
 	const FGridCellLayout& GridLayout,
 	int32 CellId,
-	const TSet<int32>& DestroyedCells)
+	const FCellBitSet& DestroyedCells)
 {
 	for (int32 Neighbor : GridLayout.GetCellNeighbors(CellId))
 	{
@@ -2322,6 +2538,340 @@ TSet<int32> FCellDestructionSystem::FindDisconnectedCellsFromAffected(
 	 
 	return DisconnectedCells;
 }
+
+namespace IncrementalConnectivityHelper
+{
+	/** Neighbor cell ID in a direction (0:-X, 1:+X, 2:-Y, 3:+Y, 4:-Z, 5:+Z), INDEX_NONE at the grid border. */
+	FORCEINLINE int32 GetNeighborCellId(int32 CellId, int32 Dir, const FIntVector& GridSize)
+	{
+		const int32 SizeXY = GridSize.X * GridSize.Y;
+		const int32 Z = CellId / SizeXY;
+		const int32 RemXY = CellId - Z * SizeXY;
+		const int32 Y = RemXY / GridSize.X;
+		const int32 X = RemXY - Y * GridSize.X;
+
+		switch (Dir)
+		{
+		case 0: return X > 0 ? CellId - 1 : INDEX_NONE;
+		case 1: return X < GridSize.X - 1 ? CellId + 1 : INDEX_NONE;
+		case 2: return Y > 0 ? CellId - GridSize.X : INDEX_NONE;
+		case 3: return Y < GridSize.Y - 1 ? CellId + GridSize.X : INDEX_NONE;
+		case 4: return Z > 0 ? CellId - SizeXY : INDEX_NONE;
+		case 5: return Z < GridSize.Z - 1 ? CellId + SizeXY : INDEX_NONE;
+		default: return INDEX_NONE;
+		}
+	}
+
+	/** Whether an alive cell can reach its neighbor under the current state. */
+	FORCEINLINE bool IsLinked(
+		const FGridCellLayout& Cache,
+		const FCellState& CellState,
+		int32 CellId,
+		int32 NeighborId,
+		int32 Dir,
+		bool bEnableSubcell)
+	{
+		if (!Cache.GetCellExists(NeighborId) || CellState.DestroyedCells.Contains(NeighborId))
+		{
+			return false;
+		}
+
+		return !bEnableSubcell || SubCellBFSHelper::HasConnectedBoundary(CellId, NeighborId, Dir, CellState);
+	}
+
+	/**
+	 * Prove a cell through the distance field.
+	 * Walks strictly decreasing distances (backtracking on dead ends) until an alive anchor or proven cell.
+	 * Cells on the found path are marked proven, exhausted cells failed, for the rest of the query.
+	 */
+	bool VerifyByDistance(
+		int32 StartCellId,
+		const FGridCellLayout& Cache,
+		const FCellState& CellState,
+		FIncrementalConnectivityCache& Connectivity,
+		bool bEnableSubcell)
+	{
+		if (Connectivity.IsProven(StartCellId))
+		{
+			return true;
+		}
+		if (Connectivity.IsFailed(StartCellId) ||
+			Connectivity.AnchorDistance[StartCellId] == FIncrementalConnectivityCache::UnknownDistance)
+		{
+			return false;
+		}
+
+		const uint32 Stamp = Connectivity.CurrentStamp;
+		TArray<FIntPoint>& Stack = Connectivity.VerifyStack;
+		Stack.Reset();
+		Stack.Push(FIntPoint(StartCellId, 0));
+
+		while (Stack.Num() > 0)
+		{
+			const int32 CellId = Stack.Last().X;
+			const int32 Dir = Stack.Last().Y++;
+
+			// All directions tried: no decreasing path from this cell
+			if (Dir >= 6)
+			{
+				Connectivity.FailedStamp[CellId] = Stamp;
+				Stack.Pop(EAllowShrinking::No);
+				continue;
+			}
+
+			const int32 NeighborId = GetNeighborCellId(CellId, Dir, Cache.GridSize);
+			if (NeighborId == INDEX_NONE ||
+				Connectivity.IsFailed(NeighborId) ||
+				Connectivity.AnchorDistance[NeighborId] >= Connectivity.AnchorDistance[CellId] ||
+				!IsLinked(Cache, CellState, CellId, NeighborId, Dir, bEnableSubcell))
+			{
+				continue;
+			}
+
+			if (Connectivity.IsProven(NeighborId) || Cache.GetCellIsAnchor(NeighborId))
+			{
+				for (const FIntPoint& Entry : Stack)
+				{
+					Connectivity.ProvenStamp[Entry.X] = Stamp;
+				}
+				Connectivity.ProvenStamp[NeighborId] = Stamp;
+				return true;
+			}
+
+			Stack.Push(FIntPoint(NeighborId, 0));
+		}
+
+		return false;
+	}
+}
+
+TSet<int32> FCellDestructionSystem::FindDisconnectedCellsIncremental(
+	const FGridCellLayout& Cache,
+	const FCellState& CellState,
+	const TArray<int32>& AffectedNeighborCells,
+	FIncrementalConnectivityCache& Connectivity,
+	bool bEnableSubcell,
+	int32 MaxIslandCells)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(DFSToAnchor_FindDisconnectedCellsIncremental);
+	using namespace IncrementalConnectivityHelper;
+
+	const int32 TotalCells = Cache.GetTotalCellCount();
+
+	// 캐시가 없거나 그리드가 바뀌었으면 전체 재구축
+	if (!Connectivity.IsBuiltFor(TotalCells))
+	{
+		return RebuildAnchorConnectivity(Cache, CellState, Connectivity, bEnableSubcell);
+	}
+
+	TSet<int32> DisconnectedCells;
+
+	Connectivity.BeginQuery();
+	const uint32 Stamp = Connectivity.CurrentStamp;
+	TArray<int32>& Distance = Connectivity.AnchorDistance;
+	TArray<int32>& Parent = Connectivity.SearchParent;
+	TArray<int32>& VisitOrder = Connectivity.VisitOrder;
+	TArray<int32>& Stack = Connectivity.WorkStack;
+
+	for (int32 StartCellId : AffectedNeighborCells)
+	{
+		if (!Cache.IsValidCellId(StartCellId))
+		{
+			continue;
+		}
+
+		// 이번 쿼리에서 이미 결론난 셀 (연결 증명 or 분리 섬 소속)
+		if (Connectivity.IsVisited(StartCellId) || Connectivity.IsProven(StartCellId))
+		{
+			continue;
+		}
+
+		if (!Cache.GetCellExists(StartCellId) || CellState.DestroyedCells.Contains(StartCellId))
+		{
+			continue;
+		}
+
+		if (Cache.GetCellIsAnchor(StartCellId))
+		{
+			Distance[StartCellId] = 0;
+			Connectivity.ProvenStamp[StartCellId] = Stamp;
+			continue;
+		}
+
+		// 캐시된 거리장으로 앵커까지 내려가는 경로가 살아있으면 탐색 불필요
+		if (VerifyByDistance(StartCellId, Cache, CellState, Connectivity, bEnableSubcell))
+		{
+			continue;
+		}
+
+		// 섬 탐색: 앵커/증명된 셀에 닿거나 섬이 소진될 때까지
+		const int32 FirstVisit = VisitOrder.Num();
+		Connectivity.VisitStamp[StartCellId] = Stamp;
+		Parent[StartCellId] = INDEX_NONE;
+		VisitOrder.Add(StartCellId);
+		Stack.Reset();
+		Stack.Push(StartCellId);
+
+		int32 HitFromCellId = INDEX_NONE;
+		int32 HitCellId = INDEX_NONE;
+
+		while (HitCellId == INDEX_NONE && Stack.Num() > 0)
+		{
+			const int32 CurrentCellId = Stack.Pop(EAllowShrinking::No);
+
+			for (int32 Dir = 0; Dir < 6; ++Dir)
+			{
+				const int32 NeighborId = GetNeighborCellId(CurrentCellId, Dir, Cache.GridSize);
+				if (NeighborId == INDEX_NONE ||
+					!IsLinked(Cache, CellState, CurrentCellId, NeighborId, Dir, bEnableSubcell))
+				{
+					continue;
+				}
+
+				// Visited by an earlier island of this query that reached an anchor
+				if (Connectivity.IsProven(NeighborId))
+				{
+					HitFromCellId = CurrentCellId;
+					HitCellId = NeighborId;
+					break;
+				}
+
+				if (Connectivity.IsVisited(NeighborId))
+				{
+					continue;
+				}
+
+				if (Cache.GetCellIsAnchor(NeighborId))
+				{
+					Distance[NeighborId] = 0;
+					HitFromCellId = CurrentCellId;
+					HitCellId = NeighborId;
+					break;
+				}
+
+				if (VerifyByDistance(NeighborId, Cache, CellState, Connectivity, bEnableSubcell))
+				{
+					HitFromCellId = CurrentCellId;
+					HitCellId = NeighborId;
+					break;
+				}
+
+				Connectivity.VisitStamp[NeighborId] = Stamp;
+				Parent[NeighborId] = CurrentCellId;
+				VisitOrder.Add(NeighborId);
+				Stack.Push(NeighborId);
+			}
+
+			// 섬이 너무 크면 국소 탐색을 포기하고 전체 재구축
+			if (VisitOrder.Num() - FirstVisit > MaxIslandCells)
+			{
+				return RebuildAnchorConnectivity(Cache, CellState, Connectivity, bEnableSubcell);
+			}
+		}
+
+		if (HitCellId != INDEX_NONE)
+		{
+			// 앵커 쪽 경로: HitFrom -> ... -> Start 순으로 거리 갱신
+			int32 PathDistance = Distance[HitCellId];
+			for (int32 CellId = HitFromCellId; CellId != INDEX_NONE; CellId = Parent[CellId])
+			{
+				Distance[CellId] = ++PathDistance;
+				Connectivity.ProvenStamp[CellId] = Stamp;
+			}
+
+			// 나머지 방문 셀: 부모가 먼저 방문되었으므로 방문 순서대로 부모 거리 + 1
+			for (int32 Index = FirstVisit; Index < VisitOrder.Num(); ++Index)
+			{
+				const int32 CellId = VisitOrder[Index];
+				if (!Connectivity.IsProven(CellId))
+				{
+					Distance[CellId] = Distance[Parent[CellId]] + 1;
+					Connectivity.ProvenStamp[CellId] = Stamp;
+				}
+			}
+		}
+		else
+		{
+			// 앵커에 닿지 못한 섬 -> 분리
+			for (int32 Index = FirstVisit; Index < VisitOrder.Num(); ++Index)
+			{
+				const int32 CellId = VisitOrder[Index];
+				Distance[CellId] = FIncrementalConnectivityCache::UnknownDistance;
+				DisconnectedCells.Add(CellId);
+			}
+		}
+	}
+
+	return DisconnectedCells;
+}
+
+TSet<int32> FCellDestructionSystem::RebuildAnchorConnectivity(
+	const FGridCellLayout& Cache,
+	const FCellState& CellState,
+	FIncrementalConnectivityCache& Connectivity,
+	bool bEnableSubcell)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_RebuildAnchorConnectivity);
+	using namespace IncrementalConnectivityHelper;
+
+	const int32 TotalCells = Cache.GetTotalCellCount();
+	Connectivity.Allocate(TotalCells);
+	Connectivity.BeginQuery();
+
+	TArray<int32>& Distance = Connectivity.AnchorDistance;
+
+	// 1. 살아있는 앵커에서 BFS 시작 (WorkStack을 FIFO로 사용)
+	TArray<int32>& Queue = Connectivity.WorkStack;
+	for (int32 CellId = 0; CellId < TotalCells; ++CellId)
+	{
+		if (Cache.GetCellExists(CellId) &&
+			Cache.GetCellIsAnchor(CellId) &&
+			!CellState.DestroyedCells.Contains(CellId))
+		{
+			Distance[CellId] = 0;
+			Queue.Add(CellId);
+		}
+	}
+
+	// 2. BFS 순회 (거리장 갱신)
+	for (int32 Head = 0; Head < Queue.Num(); ++Head)
+	{
+		const int32 CurrentCellId = Queue[Head];
+		const int32 NextDistance = Distance[CurrentCellId] + 1;
+
+		for (int32 Dir = 0; Dir < 6; ++Dir)
+		{
+			const int32 NeighborId = GetNeighborCellId(CurrentCellId, Dir, Cache.GridSize);
+			if (NeighborId == INDEX_NONE ||
+				Distance[NeighborId] != FIncrementalConnectivityCache::UnknownDistance ||
+				!IsLinked(Cache, CellState, CurrentCellId, NeighborId, Dir, bEnableSubcell))
+			{
+				continue;
+			}
+
+			Distance[NeighborId] = NextDistance;
+			Queue.Add(NeighborId);
+		}
+	}
+
+	// 3. 도달하지 못한 살아있는 셀 -> 분리
+	TSet<int32> DisconnectedCells;
+	for (int32 CellId = 0; CellId < TotalCells; ++CellId)
+	{
+		if (Distance[CellId] == FIncrementalConnectivityCache::UnknownDistance &&
+			Cache.GetCellExists(CellId) &&
+			!CellState.DestroyedCells.Contains(CellId))
+		{
+			DisconnectedCells.Add(CellId);
+		}
+	}
+
+	Queue.Reset();
+	Connectivity.bBuilt = true;
+
+	return DisconnectedCells;
+}
+
 bool FCellDestructionSystem::SupercellContainsAnchor(
 	int32 SupercellId,
 	const FGridCellLayout& Cache,
@@ -27,7 +27,7 @@ bool FGridCellBuilder::BuildFromStaticMesh(
 	const FVector& CellSize,
 	float AnchorHeightThreshold,
 	FGridCellLayout& OutLayout,
-	TMap<int32, FSubCell>* OutSubCellStates)
+	FSubCellMaskArray* OutSubCellStates)
 {
 	if (!SourceMesh)
 	{
@@ -88,6 +88,10 @@ bool FGridCellBuilder::BuildFromStaticMesh(
 
 	// 3. Initialize bitfields (zeroed)
 	OutLayout.InitializeBitfields();
+	if (OutSubCellStates)
+	{
+		OutSubCellStates->Init(TotalCells);
+	}
 
 	 // 4. Collision-based voxelization (priority: Convex > Box > Sphere > Capsule > BoundingBox)
 	 //UBodySetup* BodySetup = SourceMesh->GetBodySetup();
@@ -110,8 +114,8 @@ bool FGridCellBuilder::BuildFromStaticMesh(
 
 	 FillInsideVoxels(OutLayout);
 
-	// 6. Compute neighbors
-	CalculateNeighbors(OutLayout);
+	// 6. Build sparse index (neighbors are derived from the existence bitfield)
+	OutLayout.FinalizeSparseData();
 
 	// 7. Determine anchors
 	DetermineAnchors(OutLayout, AnchorHeightThreshold);
@@ -158,12 +162,9 @@ bool FGridCellBuilder::BuildFromDynamicMesh(
 	// 3. Initialize bitfields (zeroed)
 	OutLayout.InitializeBitfields();
 
-	// 4. Assign triangles
+	// 4. Assign triangles (also builds the sparse index)
 	AssignTrianglesToCells(Mesh, OutLayout);
 
-	// 6. Compute neighbors
-	CalculateNeighbors(OutLayout);
-
 	// 7. Determine anchors
 	DetermineAnchors(OutLayout, AnchorHeightThreshold);
 
@@ -410,8 +411,11 @@ void FGridCellBuilder::AssignTrianglesToCells(
 {
 	// 1. Voxelize first (register valid cells)
 	VoxelizeMesh(Mesh, OutLayout);
+	OutLayout.FinalizeSparseData();
 
-	// 2. Assign triangles to cells (sparse array)
+	// 2. Assign triangles to cells (CSR, indexed by triangle ID)
+	TArray<int32> TriangleCellIds;
+	TriangleCellIds.Init(INDEX_NONE, Mesh.MaxTriangleID());
 	for (int32 TriId : Mesh.TriangleIndicesItr())
 	{
 		const FIndex3i Tri = Mesh.GetTriangle(TriId);
@@ -430,15 +434,10 @@ void FGridCellBuilder::AssignTrianglesToCells(
 			FMath::FloorToInt((TriCenter.Z - OutLayout.GridOrigin.Z) / OutLayout.CellSize.Z),
 			0, OutLayout.GridSize.Z - 1);
 
-		const int32 CellId = OutLayout.CoordToId(X, Y, Z);
-
-		// Add triangle to sparse array
-		FIntArray* Triangles = OutLayout.GetCellTrianglesMutable(CellId);
-		if (Triangles)
-		{
-			Triangles->Add(TriId);
-		}
+		TriangleCellIds[TriId] = OutLayout.CoordToId(X, Y, Z);
 	}
+
+	OutLayout.BuildCellTriangles(TriangleCellIds);
 }
 
 void FGridCellBuilder::VoxelizeMesh(
@@ -449,7 +448,6 @@ void FGridCellBuilder::VoxelizeMesh(
 	const int32 TotalCells = OutLayout.GetTotalCellCount();
 	for (int32 CellId = 0; CellId < TotalCells; CellId++)
 	{
-		OutLayout.SetCellExists(CellId, true);
 		OutLayout.RegisterValidCell(CellId);
 	}
 
@@ -499,7 +497,6 @@ void FGridCellBuilder::VoxelizeWithCollision(
 		UE_LOG(LogTemp, Warning, TEXT("VoxelizeWithCollision: No collision elements, filling bounding box"));
 		for (int32 i = 0; i < TotalCells; i++)
 		{
-			OutLayout.SetCellExists(i, true);
 			OutLayout.RegisterValidCell(i);
 		}
 		return;
@@ -564,7 +561,6 @@ void FGridCellBuilder::VoxelizeWithCollision(
 		// Register valid cell
 		if (bCellExists)
 		{
-			OutLayout.SetCellExists(CellId, true);
 			OutLayout.RegisterValidCell(CellId);
 		}
 	}
@@ -585,7 +581,7 @@ void FGridCellBuilder::VoxelizeWithConvex(
 void FGridCellBuilder::VoxelizeWithTriangles(
       const UStaticMesh* SourceMesh,
       FGridCellLayout& OutLayout,
-	  TMap<int32, FSubCell>* OutSubCellStates)
+	  FSubCellMaskArray* OutSubCellStates)
 {
     // Method 0: Try cached triangle data first (works in packaged builds)
     if (OutLayout.HasCachedTriangleData())
@@ -673,7 +669,6 @@ void FGridCellBuilder::VoxelizeWithTriangles(
     const int32 TotalCells = OutLayout.GetTotalCellCount();
     for (int32 CellId = 0; CellId < TotalCells; ++CellId)
     {
-        OutLayout.SetCellExists(CellId, true);
         OutLayout.RegisterValidCell(CellId);
     }
 }
@@ -683,7 +678,7 @@ void FGridCellBuilder::VoxelizeTriangle(
     const FVector& V1,
     const FVector& V2,
     FGridCellLayout& OutLayout,
-    TMap<int32, FSubCell>* OutSubCellStates)
+    FSubCellMaskArray* OutSubCellStates)
 {
           // Compute triangle AABB
           FVector TriMin, TriMax;
@@ -735,7 +730,6 @@ void FGridCellBuilder::VoxelizeTriangle(
 					  {
 						  if (TriangleIntersectsAABB(V0, V1, V2, CellMin, CellMax))
 						  {
-							  OutLayout.SetCellExists(CellId, true);
 							  OutLayout.RegisterValidCell(CellId);
 
 							  if (OutSubCellStates)
@@ -768,7 +762,7 @@ void FGridCellBuilder::VoxelizeFromArrays(
     const TArray<FVector>& Vertices,
     const TArray<uint32>& Indices,
     FGridCellLayout& OutLayout,
-    TMap<int32, FSubCell>* OutSubCellStates)
+    FSubCellMaskArray* OutSubCellStates)
 {
     const uint32 NumVertices = Vertices.Num();
     const uint32 NumTriangles = Indices.Num() / 3;
@@ -983,7 +977,6 @@ void FGridCellBuilder::FillInsideVoxels(FGridCellLayout& OutLayout)
 		// Outside air cannot reach -> interior
 		if (!VisitedOutside.Contains(i))
 		{
-			OutLayout.SetCellExists(i, true); // Fill
 			OutLayout.RegisterValidCell(i); 
 		}
 	} 
@@ -1129,45 +1122,6 @@ bool FGridCellBuilder::IsPointInsideCapsule(
 	}
 }
 
-void FGridCellBuilder::CalculateNeighbors(FGridCellLayout& OutLayout)
-{
-	// 6 directions (+/-X, +/-Y, +/-Z)
-	static const FIntVector Directions[6] = {
-		{1, 0, 0}, {-1, 0, 0},
-		{0, 1, 0}, {0, -1, 0},
-		{0, 0, 1}, {0, 0, -1}
-	};
-
-	// Iterate valid cells only (sparse array)
-	for (int32 CellId : OutLayout.GetValidCellIds())
-	{
-		const FIntVector Coord = OutLayout.IdToCoord(CellId);
-		FIntArray* Neighbors = OutLayout.GetCellNeighborsMutable(CellId);
-		if (!Neighbors)
-		{
-			continue;
-		}
-
-		for (const FIntVector& Dir : Directions)
-		{
-			const FIntVector NeighborCoord = Coord + Dir;
-
-			// Range check
-			if (!OutLayout.IsValidCoord(NeighborCoord))
-			{
-				continue;
-			}
-
-			const int32 NeighborId = OutLayout.CoordToId(NeighborCoord);
-
-			if (OutLayout.GetCellExists(NeighborId))
-			{
-				Neighbors->Add(NeighborId);
-			}
-		}
-	}
-}
-
 void FGridCellBuilder::DetermineAnchors(
 	FGridCellLayout& OutLayout,
 	float HeightThreshold)
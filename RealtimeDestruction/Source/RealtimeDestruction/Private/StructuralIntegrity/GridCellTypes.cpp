@@ -554,6 +554,74 @@ int32 FGridCellLayout::GetAnchorCount() const
 	return Count;
 }
 
+void FGridCellLayout::FinalizeSparseData()
+{
+	const int32 TotalCells = GetTotalCellCount();
+	const int32 NumWords = CellExistsBits.Num();
+
+	// Rank table: number of existing cells before each word
+	CellRankPrefix.SetNumUninitialized(NumWords);
+	int32 RunningCount = 0;
+	for (int32 WordIndex = 0; WordIndex < NumWords; WordIndex++)
+	{
+		CellRankPrefix[WordIndex] = RunningCount;
+		RunningCount += FMath::CountBits(CellExistsBits[WordIndex]);
+	}
+
+	// Rebuild sparse -> cell ID in cell ID order so that it matches the rank
+	SparseIndexToCellId.Reset(RunningCount);
+	for (int32 WordIndex = 0; WordIndex < NumWords; WordIndex++)
+	{
+		uint32 Word = CellExistsBits[WordIndex];
+		while (Word != 0)
+		{
+			const int32 CellId = (WordIndex << 5) + FMath::CountTrailingZeros(Word);
+			Word &= Word - 1u;
+			if (CellId < TotalCells)
+			{
+				SparseIndexToCellId.Add(CellId);
+			}
+		}
+	}
+
+	CellTriangleOffsets.Empty();
+	CellTriangleData.Empty();
+}
+
+void FGridCellLayout::BuildCellTriangles(TConstArrayView<int32> TriangleCellIds)
+{
+	const int32 ValidCellCount = SparseIndexToCellId.Num();
+
+	// Pass 1: count triangles per sparse index
+	CellTriangleOffsets.SetNumZeroed(ValidCellCount + 1);
+	for (const int32 CellId : TriangleCellIds)
+	{
+		const int32 SparseIdx = GetSparseIndex(CellId);
+		if (SparseIdx != INDEX_NONE)
+		{
+			CellTriangleOffsets[SparseIdx + 1]++;
+		}
+	}
+
+	// Exclusive prefix sum -> offsets
+	for (int32 i = 0; i < ValidCellCount; i++)
+	{
+		CellTriangleOffsets[i + 1] += CellTriangleOffsets[i];
+	}
+
+	// Pass 2: scatter triangle indices (keeps triangle order within each cell)
+	CellTriangleData.SetNumUninitialized(CellTriangleOffsets[ValidCellCount]);
+	TArray<int32> WriteCursor(CellTriangleOffsets.GetData(), ValidCellCount);
+	for (int32 TriId = 0; TriId < TriangleCellIds.Num(); TriId++)
+	{
+		const int32 SparseIdx = GetSparseIndex(TriangleCellIds[TriId]);
+		if (SparseIdx != INDEX_NONE)
+		{
+			CellTriangleData[WriteCursor[SparseIdx]++] = TriId;
+		}
+	}
+}
+
 int32 FGridCellLayout::WorldPosToId(const FVector& WorldPos, const FTransform& MeshTransform) const
 {
 	// Transform world coordinates to local
@@ -648,10 +716,10 @@ void FGridCellLayout::Reset()
 	CellIsAnchorBits.Empty();
 
 	// Initialize sparse arrays
-	CellIdToSparseIndex.Empty();
+	CellRankPrefix.Empty();
 	SparseIndexToCellId.Empty();
-	SparseCellTriangles.Empty();
-	SparseCellNeighbors.Empty();
+	CellTriangleOffsets.Empty();
+	CellTriangleData.Empty();
 
 	// Note: Do NOT clear CachedVertices/CachedIndices here
 	// They need to persist for runtime rebuilds
@@ -674,10 +742,18 @@ bool FGridCellLayout::IsValid() const
 	}
 
 	// Validate sparse array consistency
+	// (rank table must cover every word and agree with the valid cell count)
 	const int32 ValidCellCount = SparseIndexToCellId.Num();
-	return SparseCellTriangles.Num() == ValidCellCount &&
-	       SparseCellNeighbors.Num() == ValidCellCount &&
-	       CellIdToSparseIndex.Num() == ValidCellCount;
+	if (CellRankPrefix.Num() != RequiredWords)
+	{
+		return false;
+	}
+	if (RequiredWords > 0 &&
+	    CellRankPrefix.Last() + FMath::CountBits(CellExistsBits.Last()) != ValidCellCount)
+	{
+		return false;
+	}
+	return CellTriangleOffsets.Num() == 0 || CellTriangleOffsets.Num() == ValidCellCount + 1;
 }
 
 TArray<int32> FGridCellLayout::GetCellsInAABB(const FBox& WorldAABB, const FTransform& MeshTransform) const
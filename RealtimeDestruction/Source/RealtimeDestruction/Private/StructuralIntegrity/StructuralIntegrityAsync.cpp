@@ -9,6 +9,46 @@
 
 #include "StructuralIntegrity/StructuralIntegrityAsync.h"
 #include "StructuralIntegrity/StructuralIntegritySystem.h"
+#include "StructuralIntegrity/CellDestructionSystem.h"
+
+//=========================================================================
+// FDetachAnalysisJob
+//=========================================================================
+
+bool FDetachAnalysisJob::Cancel()
+{
+	// Paired with Run: either Run sees bCancelled, or we see bStarted.
+	bCancelled.store(true);
+	return bStarted.load();
+}
+
+void FDetachAnalysisJob::Run(const FGridCellLayout& GridLayout, FIncrementalConnectivityCache& Connectivity)
+{
+	bStarted.store(true);
+	if (bCancelled.load())
+	{
+		return;
+	}
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(CellStructure_DetachAnalysisJob);
+
+	DisconnectedCells = FCellDestructionSystem::FindDisconnectedCellsIncremental(
+		GridLayout,
+		Snapshot,
+		SeedCells,
+		Connectivity,
+		bEnableSubcell);
+
+	if (DisconnectedCells.Num() > 0)
+	{
+		DetachedGroups = FCellDestructionSystem::GroupDetachedCells(
+			GridLayout,
+			DisconnectedCells,
+			Snapshot.DestroyedCells);
+	}
+
+	bCompleted = true;
+}
 
 //=========================================================================
 // FStructuralIntegrityAsyncTask
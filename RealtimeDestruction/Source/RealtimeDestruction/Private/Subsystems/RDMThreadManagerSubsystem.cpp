@@ -7,17 +7,97 @@
 // and warranties, express or implied, and assumes no responsibility or liability for any consequences arising from
 // the use of this product.
 
+
 #include "Subsystems/RDMThreadManagerSubsystem.h"
 
 #include "Engine/World.h"
 #include "Engine/GameInstance.h"
 #include "Tasks/Task.h"
 #include "Async/Async.h"
+#include "Misc/ScopeLock.h"
 #include "ProfilingDebugging/CountersTrace.h"
 #include "Settings/RDMSetting.h"
 TRACE_DECLARE_INT_COUNTER(RDM_ActiveUnionWorkers, TEXT("RDMThreadManager/ActiveUnionWorkers"));
 TRACE_DECLARE_INT_COUNTER(RDM_ActiveSubtractWorkers, TEXT("RDMThreadManager/ActiveSubtractWorkers"));
+TRACE_DECLARE_INT_COUNTER(RDM_ActiveIslandRemovalWorkers, TEXT("RDMThreadManager/ActiveIslandRemovalWorkers"));
+TRACE_DECLARE_INT_COUNTER(RDM_ActiveSimplifyWorkers, TEXT("RDMThreadManager/ActiveSimplifyWorkers"));
 TRACE_DECLARE_INT_COUNTER(RDM_ActiveTotalWorkers, TEXT("RDMThreadManager/RDM_ActiveTotalWorkers"));
+TRACE_DECLARE_INT_COUNTER(RDM_PendingUnion, TEXT("RDMThreadManager/PendingUnion"));
+TRACE_DECLARE_INT_COUNTER(RDM_PendingSubtract, TEXT("RDMThreadManager/PendingSubtract"));
+TRACE_DECLARE_INT_COUNTER(RDM_PendingIslandRemoval, TEXT("RDMThreadManager/PendingIslandRemoval"));
+TRACE_DECLARE_INT_COUNTER(RDM_PendingSimplify, TEXT("RDMThreadManager/PendingSimplify"));
+TRACE_DECLARE_FLOAT_COUNTER(RDM_WaitMsUnion, TEXT("RDMThreadManager/WaitMsUnion"));
+TRACE_DECLARE_FLOAT_COUNTER(RDM_WaitMsSubtract, TEXT("RDMThreadManager/WaitMsSubtract"));
+TRACE_DECLARE_FLOAT_COUNTER(RDM_WaitMsIslandRemoval, TEXT("RDMThreadManager/WaitMsIslandRemoval"));
+TRACE_DECLARE_FLOAT_COUNTER(RDM_WaitMsSimplify, TEXT("RDMThreadManager/WaitMsSimplify"));
+
+namespace
+{
+	/** Weight of the newest sample in the per-class average wait. */
+	constexpr double WaitEmaAlpha = 0.1;
+
+	const TCHAR* GetWorkClassName(ERDMWorkClass WorkClass)
+	{
+		switch (WorkClass)
+		{
+		case ERDMWorkClass::Subtract:      return TEXT("Subtract");
+		case ERDMWorkClass::Union:         return TEXT("Union");
+		case ERDMWorkClass::IslandRemoval: return TEXT("IslandRemoval");
+		case ERDMWorkClass::Simplify:      return TEXT("Simplify");
+		default:                           return TEXT("Unknown");
+		}
+	}
+
+	void TraceClassCounters(ERDMWorkClass WorkClass, int32 Pending, int32 Active, double WaitMs)
+	{
+		switch (WorkClass)
+		{
+		case ERDMWorkClass::Subtract:
+			TRACE_COUNTER_SET(RDM_PendingSubtract, Pending);
+			TRACE_COUNTER_SET(RDM_ActiveSubtractWorkers, Active);
+			TRACE_COUNTER_SET(RDM_WaitMsSubtract, WaitMs);
+			break;
+		case ERDMWorkClass::Union:
+			TRACE_COUNTER_SET(RDM_PendingUnion, Pending);
+			TRACE_COUNTER_SET(RDM_ActiveUnionWorkers, Active);
+			TRACE_COUNTER_SET(RDM_WaitMsUnion, WaitMs);
+			break;
+		case ERDMWorkClass::IslandRemoval:
+			TRACE_COUNTER_SET(RDM_PendingIslandRemoval, Pending);
+			TRACE_COUNTER_SET(RDM_ActiveIslandRemovalWorkers, Active);
+			TRACE_COUNTER_SET(RDM_WaitMsIslandRemoval, WaitMs);
+			break;
+		case ERDMWorkClass::Simplify:
+			TRACE_COUNTER_SET(RDM_PendingSimplify, Pending);
+			TRACE_COUNTER_SET(RDM_ActiveSimplifyWorkers, Active);
+			TRACE_COUNTER_SET(RDM_WaitMsSimplify, WaitMs);
+			break;
+		default:
+			break;
+		}
+	}
+}
+
+FRDMTaskSignal::FRDMTaskSignal()
+	: Event(TEXT("RDMTaskSignal"))
+{
+	// Inline: completes on the thread that triggers the event, without a scheduling hop.
+	Task = UE::Tasks::Launch(UE_SOURCE_LOCATION, []() {}, UE::Tasks::Prerequisites(Event),
+		UE::Tasks::ETaskPriority::Normal, UE::Tasks::EExtendedTaskPriority::Inline);
+}
+
+FRDMTaskSignal::~FRDMTaskSignal()
+{
+	Trigger();
+}
+
+void FRDMTaskSignal::Trigger()
+{
+	if (!bTriggered.exchange(true))
+	{
+		Event.Trigger();
+	}
+}
 
 void URDMThreadManagerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 {
@@ -26,6 +106,14 @@ void URDMThreadManagerSubsystem::Initialize(FSubsystemCollectionBase& Collection
 	bIsShuttingDown.store(false);
 	ActiveWorkers.store(0);
 	PendingCount.store(0);
+	for (int32 ClassIndex = 0; ClassIndex < NumWorkClasses; ++ClassIndex)
+	{
+		ClassActiveWorkers[ClassIndex].store(0);
+		ClassPendingCount[ClassIndex].store(0);
+		ClassAvgWaitMs[ClassIndex] = 0.0;
+		ClassMaxWaitMs[ClassIndex] = 0.0;
+		ClassDispatchedCount[ClassIndex] = 0;
+	}
 	
 	// 하드웨어 기반으로 할거면 NumCores를 사용해서 휴리스틱하게 설정 
 	int32 NumCores= FPlatformMisc::NumberOfCoresIncludingHyperthreads();
@@ -34,7 +122,11 @@ void URDMThreadManagerSubsystem::Initialize(FSubsystemCollectionBase& Collection
 	if (const URDMSetting* Settings = URDMSetting::Get())
 	{
 		MaxTotalWorkers = Settings->GetEffectiveThreadCount();
+		OffScreenMaxWaitSeconds = FMath::Max(0.0f, Settings->OffScreenMaxWaitSeconds);
 	}
+
+	// 클래스별 동시 실행 상한 계산
+	UpdateClassCaps();
 }
  
 void URDMThreadManagerSubsystem::Deinitialize()
@@ -42,9 +134,24 @@ void URDMThreadManagerSubsystem::Deinitialize()
 	bIsShuttingDown.store(true);
 
 	// 대기 큐 비우기
-	TFunction<void()> Dummy;
-	while (PendingQueue.Dequeue(Dummy)) {}
-	PendingCount.store(0);
+	{
+		FScopeLock Lock(&QueueLock);
+		for (int32 PriorityIndex = 0; PriorityIndex < NumWorkPriorities; ++PriorityIndex)
+		{
+			for (int32 ClassIndex = 0; ClassIndex < NumWorkClasses; ++ClassIndex)
+			{
+				FClassQueue& Queue = PendingQueues[PriorityIndex][ClassIndex];
+				Queue.Requesters.Empty();
+				Queue.NextRequester = 0;
+				Queue.Num = 0;
+			}
+		}
+		for (int32 ClassIndex = 0; ClassIndex < NumWorkClasses; ++ClassIndex)
+		{
+			ClassPendingCount[ClassIndex].store(0);
+		}
+		PendingCount.store(0);
+	}
 
 	// 활성 Worker 종료 대기 (최대 1초)
 	double StartTime = FPlatformTime::Seconds();
@@ -75,25 +182,180 @@ URDMThreadManagerSubsystem* URDMThreadManagerSubsystem::Get(UWorld* World)
 
 void URDMThreadManagerSubsystem::RequestWork(TFunction<void()>&& WorkFunc, UObject* Requester)
 {
+	RequestWork(MoveTemp(WorkFunc), Requester, ERDMWorkClass::Subtract, ERDMWorkPriority::Visible);
+}
+
+void URDMThreadManagerSubsystem::RequestWork(TFunction<void()>&& WorkFunc, UObject* Requester, ERDMWorkClass WorkClass, ERDMWorkPriority Priority)
+{
+	if (bIsShuttingDown.load() || WorkClass >= ERDMWorkClass::Num || Priority >= ERDMWorkPriority::Num)
+	{
+		return;
+	}
+
+	FRDMWorkerRequest Request;
+	Request.WorkFunc = MoveTemp(WorkFunc);
+	Request.WorkClass = WorkClass;
+	Request.Priority = Priority;
+	Request.Requester = Requester;
+	Request.EnqueueTime = FPlatformTime::Seconds();
+
+	// 항상 대기 큐를 거쳐서 실행 (우선순위/공정성을 지키기 위해 바로 실행하지 않음)
+	{
+		FScopeLock Lock(&QueueLock);
+
+		FClassQueue& Queue = GetQueue(WorkClass, Priority);
+		FRequesterQueue* RequesterQueue = Queue.Requesters.FindByPredicate([&Request](const FRequesterQueue& Entry)
+		{
+			return Entry.Requester == Request.Requester;
+		});
+		if (!RequesterQueue)
+		{
+			// 새 요청자는 라운드로빈 순서의 맨 뒤에 추가
+			RequesterQueue = &Queue.Requesters.AddDefaulted_GetRef();
+			RequesterQueue->Requester = Request.Requester;
+			RequesterQueue->Requests = MakeUnique<TQueue<FRDMWorkerRequest>>();
+		}
+
+		RequesterQueue->Requests->Enqueue(MoveTemp(Request));
+		++RequesterQueue->Num;
+		++Queue.Num;
+
+		PendingCount.fetch_add(1);
+		const int32 ClassIndex = static_cast<int32>(WorkClass);
+		const int32 ClassPending = ClassPendingCount[ClassIndex].fetch_add(1) + 1;
+		TraceClassCounters(WorkClass, ClassPending, ClassActiveWorkers[ClassIndex].load(), ClassAvgWaitMs[ClassIndex]);
+	}
+
+	TryDispatchPending();
+}
+
+UE::Tasks::FTask URDMThreadManagerSubsystem::RequestTask(TFunction<void()>&& WorkFunc, UObject* Requester, ERDMWorkClass WorkClass, ERDMWorkPriority Priority,
+	const TArray<UE::Tasks::FTask>& Prerequisites)
+{
+	// 작업이 실행되거나 버려지면(Done 소멸) 완료 -> 후속 작업이 멈추지 않음
+	TSharedRef<FRDMTaskSignal, ESPMode::ThreadSafe> Done = MakeShared<FRDMTaskSignal, ESPMode::ThreadSafe>();
+	UE::Tasks::FTask DoneTask = Done->GetTask();
+
+	TWeakObjectPtr<URDMThreadManagerSubsystem> WeakThis(this);
+	TWeakObjectPtr<UObject> WeakRequester(Requester);
+
+	// 선행 작업이 끝난 스레드에서 바로 대기 큐에 넣음 (Inline, worker를 점유하지 않음)
+	UE::Tasks::Launch(UE_SOURCE_LOCATION,
+		[WeakThis, WeakRequester, WorkClass, Priority, Done, Func = MoveTemp(WorkFunc)]() mutable
+		{
+			URDMThreadManagerSubsystem* Manager = WeakThis.Get();
+			if (!Manager)
+			{
+				return;
+			}
+
+			Manager->RequestWork(
+				[Done, Func = MoveTemp(Func)]() mutable
+				{
+					Func();
+					Done->Trigger();
+				},
+				WeakRequester.Get(), WorkClass, Priority);
+		},
+		Prerequisites, UE::Tasks::ETaskPriority::Normal, UE::Tasks::EExtendedTaskPriority::Inline);
+
+	return DoneTask;
+}
+
+int32 URDMThreadManagerSubsystem::TryReserveWorkers(int32 Desired)
+{
+	if (Desired <= 0 || bIsShuttingDown.load())
+	{
+		return 0;
+	}
+
+	// CAS 루프: MaxTotalWorkers를 넘지 않는 만큼만 예약
+	int32 Current = ActiveWorkers.load();
+	while (true)
+	{
+		const int32 Granted = FMath::Min(Desired, MaxTotalWorkers - Current);
+		if (Granted <= 0)
+		{
+			return 0;
+		}
+
+		if (ActiveWorkers.compare_exchange_weak(Current, Current + Granted))
+		{
+			return Granted;
+		}
+	}
+}
+
+double URDMThreadManagerSubsystem::GetResultApplySpentMs()
+{
+	check(IsInGameThread());
+
+	if (ResultApplyFrame != GFrameCounter)
+	{
+		ResultApplyFrame = GFrameCounter;
+		ResultApplySpentMs = 0.0;
+	}
+	return ResultApplySpentMs;
+}
+
+void URDMThreadManagerSubsystem::AddResultApplySpentMs(double Ms)
+{
+	GetResultApplySpentMs();
+	ResultApplySpentMs += Ms;
+}
+
+void URDMThreadManagerSubsystem::ReleaseReservedWorkers(int32 Count)
+{
+	if (Count <= 0)
+	{
+		return;
+	}
+
+	ActiveWorkers.fetch_sub(Count);
+
 	if (bIsShuttingDown.load())
 	{
 		return;
 	}
 
-	// Active Worker 수 체크
-	int32 CurrentActive = ActiveWorkers.load();
+	// 반납된 worker로 대기 작업 처리
+	TryDispatchPending();
+}
 
-	if (CurrentActive < MaxTotalWorkers)
+void URDMThreadManagerSubsystem::SetClassMaxWorkers(ERDMWorkClass WorkClass, int32 Max)
+{
+	if (WorkClass >= ERDMWorkClass::Num)
 	{
-		// 남는 worker가 있다면 실행
-		LaunchWork(MoveTemp(WorkFunc));
+		return;
 	}
-	else
+
 	{
-		// worker가 없다면 대기 큐에 추가 
-		PendingQueue.Enqueue(MoveTemp(WorkFunc));
-		PendingCount.fetch_add(1); 
+		FScopeLock Lock(&QueueLock);
+		ClassMaxWorkers[static_cast<int32>(WorkClass)] = FMath::Clamp(Max, 1, MaxTotalWorkers);
 	}
+
+	// 상한이 늘었으면 막혀 있던 작업 실행
+	TryDispatchPending();
+}
+
+FRDMWorkClassStats URDMThreadManagerSubsystem::GetClassStats(ERDMWorkClass WorkClass) const
+{
+	FRDMWorkClassStats Stats;
+	if (WorkClass >= ERDMWorkClass::Num)
+	{
+		return Stats;
+	}
+
+	const int32 ClassIndex = static_cast<int32>(WorkClass);
+
+	FScopeLock Lock(&QueueLock);
+	Stats.Pending = ClassPendingCount[ClassIndex].load();
+	Stats.Active = ClassActiveWorkers[ClassIndex].load();
+	Stats.MaxWorkers = ClassMaxWorkers[ClassIndex];
+	Stats.AvgWaitMs = ClassAvgWaitMs[ClassIndex];
+	Stats.MaxWaitMs = ClassMaxWaitMs[ClassIndex];
+	Stats.DispatchedCount = ClassDispatchedCount[ClassIndex];
+	return Stats;
 }
 
 void URDMThreadManagerSubsystem::LogStatus() const
@@ -102,23 +364,37 @@ void URDMThreadManagerSubsystem::LogStatus() const
 		ActiveWorkers.load(),
 		MaxTotalWorkers,
 		PendingCount.load());
+
+	for (int32 ClassIndex = 0; ClassIndex < NumWorkClasses; ++ClassIndex)
+	{
+		const ERDMWorkClass WorkClass = static_cast<ERDMWorkClass>(ClassIndex);
+		const FRDMWorkClassStats Stats = GetClassStats(WorkClass);
+		UE_LOG(LogTemp, Warning, TEXT("[RDMThreadManager]   %s - Active: %d / %d, Pending: %d, Wait: avg %.2fms / max %.2fms, Dispatched: %lld"),
+			GetWorkClassName(WorkClass),
+			Stats.Active,
+			Stats.MaxWorkers,
+			Stats.Pending,
+			Stats.AvgWaitMs,
+			Stats.MaxWaitMs,
+			Stats.DispatchedCount);
+	}
 }
 
-void URDMThreadManagerSubsystem::LaunchWork(TFunction<void()>&& WorkFunc)
+void URDMThreadManagerSubsystem::LaunchWork(FRDMWorkerRequest&& Request)
 {
-	ActiveWorkers.fetch_add(1); 
-	
+	// ActiveWorkers / ClassActiveWorkers는 TryDispatchPending에서 이미 예약됨
 	TWeakObjectPtr<URDMThreadManagerSubsystem> WeakThis(this);
+	const ERDMWorkClass WorkClass = Request.WorkClass;
 
 	UE::Tasks::Launch(UE_SOURCE_LOCATION,
-		[WeakThis, Func = MoveTemp(WorkFunc)]() mutable
+		[WeakThis, WorkClass, Func = MoveTemp(Request.WorkFunc)]() mutable
 		{
 			// 작업 실행
 			Func();
 
 				if (URDMThreadManagerSubsystem* Manager = WeakThis.Get())
 				{
-					Manager->OnWorkComplete();
+					Manager->OnWorkComplete(WorkClass);
 				}
 
 			// 완료 처리 (GameThread에서)
@@ -132,8 +408,9 @@ void URDMThreadManagerSubsystem::LaunchWork(TFunction<void()>&& WorkFunc)
 		});
 }
 
-void URDMThreadManagerSubsystem::OnWorkComplete()
+void URDMThreadManagerSubsystem::OnWorkComplete(ERDMWorkClass WorkClass)
 {
+	ClassActiveWorkers[static_cast<int32>(WorkClass)].fetch_sub(1);
 	ActiveWorkers.fetch_sub(1);
 
 	if (bIsShuttingDown.load())
@@ -147,19 +424,162 @@ void URDMThreadManagerSubsystem::OnWorkComplete()
 
 void URDMThreadManagerSubsystem::TryDispatchPending()
 {
-	// worker가 있고 대기 작업이 있으면 실행
-	while (ActiveWorkers.load() < MaxTotalWorkers)
+	TArray<FRDMWorkerRequest, TInlineAllocator<8>> ToLaunch;
 	{
-		TFunction<void()> WorkFunc;
+		FScopeLock Lock(&QueueLock);
 
-		if (!PendingQueue.Dequeue(WorkFunc))
+		const double Now = FPlatformTime::Seconds();
+
+		// worker가 있고 실행 가능한 대기 작업이 있으면 실행
+		while (PendingCount.load() > 0)
 		{
-			// 대기 큐 비었음
-			break;
+			FClassQueue* Queue = SelectQueue(Now);
+			if (!Queue)
+			{
+				// 대기 작업이 모두 클래스 상한에 걸려 있음
+				break;
+			}
+
+			if (TryReserveWorkers(1) == 0)
+			{
+				// 남는 worker 없음
+				break;
+			}
+
+			FRDMWorkerRequest Request;
+			if (!PopRequest(*Queue, Request))
+			{
+				ActiveWorkers.fetch_sub(1);
+				break;
+			}
+
+			const int32 ClassIndex = static_cast<int32>(Request.WorkClass);
+			const int32 ClassActive = ClassActiveWorkers[ClassIndex].fetch_add(1) + 1;
+			const int32 ClassPending = ClassPendingCount[ClassIndex].fetch_sub(1) - 1;
+			PendingCount.fetch_sub(1);
+
+			RecordWait(Request.WorkClass, (Now - Request.EnqueueTime) * 1000.0);
+			TraceClassCounters(Request.WorkClass, ClassPending, ClassActive, ClassAvgWaitMs[ClassIndex]);
+
+			ToLaunch.Add(MoveTemp(Request));
 		}
+	}
 
-		PendingCount.fetch_sub(1);
-		LaunchWork(MoveTemp(WorkFunc));
+	TRACE_COUNTER_SET(RDM_ActiveTotalWorkers, ActiveWorkers.load());
+
+	// 락 밖에서 실행 (Launch 중 다른 스레드의 요청/완료를 막지 않도록)
+	for (FRDMWorkerRequest& Request : ToLaunch)
+	{
+		LaunchWork(MoveTemp(Request));
 	}
 }
+
+URDMThreadManagerSubsystem::FClassQueue* URDMThreadManagerSubsystem::SelectQueue(double Now)
+{
+	auto IsRunnable = [this](const FClassQueue& Queue, int32 ClassIndex)
+	{
+		return Queue.Num > 0 && ClassActiveWorkers[ClassIndex].load() < ClassMaxWorkers[ClassIndex];
+	};
+
+	// 1. 너무 오래 기다린 화면 밖 작업 (굶주림 방지)
+	const int32 OffScreenIndex = static_cast<int32>(ERDMWorkPriority::OffScreen);
+	for (int32 ClassIndex = 0; ClassIndex < NumWorkClasses; ++ClassIndex)
+	{
+		FClassQueue& Queue = PendingQueues[OffScreenIndex][ClassIndex];
+		if (!IsRunnable(Queue, ClassIndex))
+		{
+			continue;
+		}
+
+		for (const FRequesterQueue& RequesterQueue : Queue.Requesters)
+		{
+			const FRDMWorkerRequest* Oldest = RequesterQueue.Requests->Peek();
+			if (Oldest && Now - Oldest->EnqueueTime >= OffScreenMaxWaitSeconds)
+			{
+				return &Queue;
+			}
+		}
+	}
+
+	// 2. 화면 안 -> 화면 밖, 그 안에서는 클래스 순서 (Subtract -> Union -> IslandRemoval -> Simplify)
+	for (int32 PriorityIndex = 0; PriorityIndex < NumWorkPriorities; ++PriorityIndex)
+	{
+		for (int32 ClassIndex = 0; ClassIndex < NumWorkClasses; ++ClassIndex)
+		{
+			FClassQueue& Queue = PendingQueues[PriorityIndex][ClassIndex];
+			if (IsRunnable(Queue, ClassIndex))
+			{
+				return &Queue;
+			}
+		}
+	}
+
+	return nullptr;
+}
+
+bool URDMThreadManagerSubsystem::PopRequest(FClassQueue& Queue, FRDMWorkerRequest& OutRequest)
+{
+	if (Queue.Requesters.Num() == 0)
+	{
+		return false;
+	}
+
+	if (Queue.NextRequester >= Queue.Requesters.Num())
+	{
+		Queue.NextRequester = 0;
+	}
+
+	FRequesterQueue& RequesterQueue = Queue.Requesters[Queue.NextRequester];
+	if (!RequesterQueue.Requests->Dequeue(OutRequest))
+	{
+		return false;
+	}
+	--RequesterQueue.Num;
+	--Queue.Num;
+
+	if (RequesterQueue.Num == 0)
+	{
+		// 다음 요청자가 이 인덱스로 당겨지므로 NextRequester는 그대로
+		Queue.Requesters.RemoveAt(Queue.NextRequester);
+	}
+	else
+	{
+		++Queue.NextRequester;
+	}
+
+	if (Queue.NextRequester >= Queue.Requesters.Num())
+	{
+		Queue.NextRequester = 0;
+	}
+	return true;
+}
+
+void URDMThreadManagerSubsystem::UpdateClassCaps()
+{
+	int32 CapPercentages[NumWorkClasses] = { 100, 75, 50, 25 };
+	if (const URDMSetting* Settings = URDMSetting::Get())
+	{
+		CapPercentages[static_cast<int32>(ERDMWorkClass::Subtract)] = Settings->SubtractWorkerCapPercentage;
+		CapPercentages[static_cast<int32>(ERDMWorkClass::Union)] = Settings->UnionWorkerCapPercentage;
+		CapPercentages[static_cast<int32>(ERDMWorkClass::IslandRemoval)] = Settings->IslandRemovalWorkerCapPercentage;
+		CapPercentages[static_cast<int32>(ERDMWorkClass::Simplify)] = Settings->SimplifyWorkerCapPercentage;
+	}
+
+	FScopeLock Lock(&QueueLock);
+	for (int32 ClassIndex = 0; ClassIndex < NumWorkClasses; ++ClassIndex)
+	{
+		const int32 Cap = FMath::CeilToInt(MaxTotalWorkers * CapPercentages[ClassIndex] / 100.0f);
+		ClassMaxWorkers[ClassIndex] = FMath::Clamp(Cap, 1, MaxTotalWorkers);
+	}
+}
+
+void URDMThreadManagerSubsystem::RecordWait(ERDMWorkClass WorkClass, double WaitMs)
+{
+	const int32 ClassIndex = static_cast<int32>(WorkClass);
+	ClassAvgWaitMs[ClassIndex] = ClassDispatchedCount[ClassIndex] == 0
+		? WaitMs
+		: ClassAvgWaitMs[ClassIndex] + (WaitMs - ClassAvgWaitMs[ClassIndex]) * WaitEmaAlpha;
+	ClassMaxWaitMs[ClassIndex] = FMath::Max(ClassMaxWaitMs[ClassIndex], WaitMs);
+	++ClassDispatchedCount[ClassIndex];
+}
   
@@ -0,0 +1,76 @@
+// Copyright (c) 2026 LazyDevelopers <lazydeveloper24@gmail.com>. All rights reserved.
+// This plugin is distributed under the Fab Standard License.
+//
+// This product was independently developed by us while participating in the Epic Project, a developer-support
+// program of the KRAFTON JUNGLE GameTech Lab. All rights, title, and interest in and to the product are exclusively
+// vested in us. Krafton, Inc. was not involved in its development and distribution and disclaims all representations
+// and warranties, express or implied, and assumes no responsibility or liability for any consequences arising from
+// the use of this product.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Online per-chunk cost model for the chunk subtract boolean.
+ *
+ * Predicts boolean time (ms) as a linear function of
+ * (1, chunk triangles, combined tool triangles, union count),
+ * fitted by recursive least squares with exponential forgetting so it follows
+ * the chunk as it gets more complex. A small ridge term and a trace cap keep the
+ * covariance bounded when features are collinear. Not thread-safe; the owner serializes access.
+ */
+struct REALTIMEDESTRUCTION_API FBooleanCostModel
+{
+	static constexpr int32 NumFeatures = 4;
+
+	/** Samples needed before predictions are trusted over the step heuristic. */
+	static constexpr int32 MinSamples = 6;
+
+	/** Forgetting factor: weight of older samples decays by this per new sample. */
+	static constexpr double ForgettingFactor = 0.95;
+
+	FBooleanCostModel() { Reset(); }
+
+	void Reset();
+
+	/** Records one measured boolean and refits the weights. */
+	void AddSample(int32 ChunkTriCount, int32 ToolTriCount, int32 UnionCount, double DurationMs);
+
+	/** Predicted boolean time in ms (never negative). */
+	double Predict(int32 ChunkTriCount, int32 ToolTriCount, int32 UnionCount) const;
+
+	/**
+	 * Largest union count whose predicted time stays within TargetMs for the chunk's current size,
+	 * assuming tools keep their recent average triangle count. Clamped to [1, MaxCount].
+	 */
+	int32 SolveUnionCount(double TargetMs, int32 MaxCount) const;
+
+	/** Predicted time for UnionCount tools on the chunk at its last sampled size. */
+	double PredictForUnionCount(int32 UnionCount) const;
+
+	bool IsReady() const { return SampleCount >= MinSamples; }
+	int32 GetSampleCount() const { return SampleCount; }
+
+	/** Chunk triangle count of the last sample. */
+	int32 GetLastChunkTriCount() const { return LastChunkTriCount; }
+
+	/** Prediction made for the last sample before it was fitted, and the measured time. */
+	double GetLastPredictedMs() const { return LastPredictedMs; }
+	double GetLastMeasuredMs() const { return LastMeasuredMs; }
+
+private:
+	void ResetCovariance();
+
+	static void MakeFeatures(int32 ChunkTriCount, int32 ToolTriCount, int32 UnionCount, double (&OutFeatures)[NumFeatures]);
+
+	double Weights[NumFeatures];
+	double Covariance[NumFeatures][NumFeatures];
+
+	int32 SampleCount = 0;
+	int32 LastChunkTriCount = 0;
+	double AvgToolTrisPerUnion = 0.0;
+
+	double LastPredictedMs = 0.0;
+	double LastMeasuredMs = 0.0;
+};
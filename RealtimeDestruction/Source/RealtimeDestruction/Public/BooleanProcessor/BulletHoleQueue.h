@@ -0,0 +1,116 @@
+// Copyright (c) 2026 LazyDevelopers <lazydeveloper24@gmail.com>. All rights reserved.
+// This plugin is distributed under the Fab Standard License.
+//
+// This product was independently developed by us while participating in the Epic Project, a developer-support
+// program of the KRAFTON JUNGLE GameTech Lab. All rights, title, and interest in and to the product are exclusively
+// vested in us. Krafton, Inc. was not involved in its development and distribution and disclaims all representations
+// and warranties, express or implied, and assumes no responsibility or liability for any consequences arising from
+// the use of this product.
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+#include "UObject/WeakObjectPtr.h"
+#include "DynamicMesh/DynamicMesh3.h"
+
+class UDecalComponent;
+class UDynamicMeshComponent;
+
+/** A single tool impact request queued for boolean processing. Stored field-by-field (SoA) in FBulletHoleQueue. */
+struct FBulletHole
+{
+	FTransform ToolTransform = {};
+	uint8 Attempts = 0;
+	static constexpr uint8 MaxAttempts = 2;
+
+	// true: penetration, false: non-penetration
+	bool bIsPenetration = false;
+
+	TWeakObjectPtr<UDecalComponent> TemporaryDecal = nullptr;
+
+	TSharedPtr<const UE::Geometry::FDynamicMesh3, ESPMode::ThreadSafe> ToolMeshPtr = nullptr;
+
+	TWeakObjectPtr<UDynamicMeshComponent> TargetMesh = nullptr;
+
+	int32 ChunkIndex = INDEX_NONE;
+
+	/** Batch completion tracking ID (no tracking if INDEX_NONE) */
+	int32 BatchId = INDEX_NONE;
+
+	bool CanRetry() const { return Attempts <= MaxAttempts; }
+
+	void Reset()
+	{
+		ToolTransform = {};
+		Attempts = 0;
+		bIsPenetration = false;
+		TemporaryDecal = nullptr;
+		ToolMeshPtr = nullptr;
+		TargetMesh = nullptr;
+		ChunkIndex = INDEX_NONE;
+		BatchId = INDEX_NONE;
+	}
+};
+
+/**
+ * Bounded multi-producer / single-consumer ring of FBulletHole requests.
+ *
+ * Slots are preallocated once in Initialize() and each field lives in its own array (SoA),
+ * so enqueueing never allocates and the game thread drains contiguous memory.
+ * Producers claim a slot with a CAS on the enqueue cursor and publish it through the slot's
+ * sequence number; Dequeue/IsEmpty/Reset must only be called by the single consumer.
+ * Enqueue fails instead of growing when the ring is full; the caller decides what to do with the op.
+ */
+class REALTIMEDESTRUCTION_API FBulletHoleQueue
+{
+public:
+	FBulletHoleQueue() = default;
+	FBulletHoleQueue(const FBulletHoleQueue&) = delete;
+	FBulletHoleQueue& operator=(const FBulletHoleQueue&) = delete;
+
+	/** Allocates the ring. Capacity is rounded up to a power of two. Not thread-safe; call before producers start. */
+	void Initialize(int32 InCapacity);
+
+	/** Drops all queued requests (consumer side). */
+	void Reset();
+
+	/** @return false if the ring is full (or not initialized); Op is left untouched in that case. */
+	bool Enqueue(FBulletHole&& Op);
+	bool Enqueue(const FBulletHole& Op);
+
+	bool Dequeue(FBulletHole& OutOp);
+
+	bool IsEmpty() const;
+
+	/** Approximate number of queued requests. */
+	int32 Num() const;
+
+	int32 GetCapacity() const { return Capacity; }
+
+	/** Number of Enqueue calls refused because the ring was full. */
+	int64 GetRejectedCount() const { return RejectedCount.load(std::memory_order_relaxed); }
+
+private:
+	template <typename OpType>
+	bool EnqueueInternal(OpType&& Op);
+
+	TUniquePtr<std::atomic<uint64>[]> Sequences;
+
+	TArray<FTransform> ToolTransforms;
+	TArray<uint8> Attempts;
+	TArray<bool> bIsPenetrations;
+	TArray<TWeakObjectPtr<UDecalComponent>> TemporaryDecals;
+	TArray<TSharedPtr<const UE::Geometry::FDynamicMesh3, ESPMode::ThreadSafe>> ToolMeshPtrs;
+	TArray<TWeakObjectPtr<UDynamicMeshComponent>> TargetMeshes;
+	TArray<int32> ChunkIndices;
+	TArray<int32> BatchIds;
+
+	int32 Capacity = 0;
+	uint64 Mask = 0;
+
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> EnqueuePos{0};
+	alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint64> DequeuePos{0};
+	std::atomic<int64> RejectedCount{0};
+};
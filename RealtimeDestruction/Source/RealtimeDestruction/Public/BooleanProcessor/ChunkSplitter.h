@@ -0,0 +1,63 @@
+// Copyright (c) 2026 LazyDevelopers <lazydeveloper24@gmail.com>. All rights reserved.
+// This plugin is distributed under the Fab Standard License.
+//
+// This product was independently developed by us while participating in the Epic Project, a developer-support
+// program of the KRAFTON JUNGLE GameTech Lab. All rights, title, and interest in and to the product are exclusively
+// vested in us. Krafton, Inc. was not involved in its development and distribution and disclaims all representations
+// and warranties, express or implied, and assumes no responsibility or liability for any consequences arising from
+// the use of this product.
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DynamicMesh/DynamicMesh3.h"
+
+struct FGridCellLayout;
+
+/**
+ * Cuts one chunk mesh into up to eight axis-aligned parts along grid cell boundaries.
+ * Used to split chunks whose boolean cost keeps growing; the parts become separate chunks.
+ * Stateless; SplitMesh is safe to call from worker threads.
+ */
+struct REALTIMEDESTRUCTION_API FChunkSplitter
+{
+	/** An axis is split only if both sides keep at least this many grid cells. */
+	static constexpr int32 MinCellsPerSide = 2;
+
+	struct FPart
+	{
+		/** Region this part owns, in owner component local space. */
+		FBox Region = FBox(ForceInit);
+
+		/** Part geometry, in chunk local space (same space as the source mesh). */
+		UE::Geometry::FDynamicMesh3 Mesh;
+	};
+
+	struct FPlan
+	{
+		/** Split point snapped to grid lines, in owner component local space. */
+		FVector SplitPoint = FVector::ZeroVector;
+
+		bool bSplitAxis[3] = { false, false, false };
+
+		int32 GetAxisCount() const { return (bSplitAxis[0] ? 1 : 0) + (bSplitAxis[1] ? 1 : 0) + (bSplitAxis[2] ? 1 : 0); }
+
+		/** Largest number of parts the plan can produce. */
+		int32 GetMaxPartCount() const { return 1 << GetAxisCount(); }
+	};
+
+	/**
+	 * Chooses split planes for Region (owner local). Falls back to the region center when the layout is invalid.
+	 * @return false if no axis is long enough to split
+	 */
+	static bool BuildPlan(const FBox& Region, const FGridCellLayout& Layout, FPlan& OutPlan);
+
+	/**
+	 * Cuts Mesh into the parts of Plan; the cut faces are capped so every part stays closed.
+	 * Parts without triangles are omitted. OutParts[0] always lies on the low side of every split axis present.
+	 * @param ChunkToOwner - Transform from chunk local space to owner component local space
+	 */
+	static void SplitMesh(const UE::Geometry::FDynamicMesh3& Mesh, const FTransform& ChunkToOwner, const FBox& Region,
+		const FPlan& Plan, TArray<FPart>& OutParts);
+};
@@ -0,0 +1,89 @@
+// Copyright (c) 2026 LazyDevelopers <lazydeveloper24@gmail.com>. All rights reserved.
+// This plugin is distributed under the Fab Standard License.
+//
+// This product was independently developed by us while participating in the Epic Project, a developer-support
+// program of the KRAFTON JUNGLE GameTech Lab. All rights, title, and interest in and to the product are exclusively
+// vested in us. Krafton, Inc. was not involved in its development and distribution and disclaims all representations
+// and warranties, express or implied, and assumes no responsibility or liability for any consequences arising from
+// the use of this product.
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "DynamicMesh/DynamicMesh3.h"
+
+/**
+ * Per-thread pool of reusable FDynamicMesh3 scratch buffers for the boolean workers.
+ *
+ * Worker-local temporaries (transformed tool copies, union pair results, debris and patch outputs)
+ * are leased from the calling thread's free list and returned when the lease goes out of scope.
+ * A returned mesh keeps its contents: the next user overwrites it by assignment (or as a
+ * boolean output), which reuses the already-grown vertex/triangle storage instead of freeing it.
+ * Leases may be released on a different thread than they were acquired on; the mesh then
+ * joins that thread's pool.
+ */
+class REALTIMEDESTRUCTION_API FMeshScratchPool
+{
+public:
+	/** Move-only lease on a pooled mesh. Contents on acquire are unspecified; overwrite before use. */
+	class REALTIMEDESTRUCTION_API FScopedMesh
+	{
+	public:
+		FScopedMesh() = default;
+		~FScopedMesh();
+
+		FScopedMesh(FScopedMesh&& Other) = default;
+		FScopedMesh& operator=(FScopedMesh&& Other);
+
+		FScopedMesh(const FScopedMesh&) = delete;
+		FScopedMesh& operator=(const FScopedMesh&) = delete;
+
+		bool IsValid() const { return Mesh.IsValid(); }
+
+		UE::Geometry::FDynamicMesh3* Get() const { return Mesh.Get(); }
+		UE::Geometry::FDynamicMesh3& operator*() const { check(Mesh.IsValid()); return *Mesh; }
+		UE::Geometry::FDynamicMesh3* operator->() const { check(Mesh.IsValid()); return Mesh.Get(); }
+
+		/** Moves the contents out for a mesh that outlives the worker (e.g. handed to the game thread). */
+		UE::Geometry::FDynamicMesh3 Detach();
+
+	private:
+		friend class FMeshScratchPool;
+		explicit FScopedMesh(TUniquePtr<UE::Geometry::FDynamicMesh3>&& InMesh) : Mesh(MoveTemp(InMesh)) {}
+
+		TUniquePtr<UE::Geometry::FDynamicMesh3> Mesh;
+	};
+
+	struct FStats
+	{
+		/** Leases handed out. */
+		int64 Acquired = 0;
+		/** Leases served from a thread's free list. */
+		int64 Reused = 0;
+		/** Leases that had to allocate a new mesh. */
+		int64 Allocated = 0;
+		/** Returned meshes freed because the pool was full or the mesh was oversized. */
+		int64 Dropped = 0;
+		/** Leases whose contents were moved out with Detach(). */
+		int64 Detached = 0;
+	};
+
+	/** Leases a mesh from the calling thread's pool, allocating one if the pool is empty. */
+	static FScopedMesh Acquire();
+
+	/** Leases a mesh and copies Source into it. */
+	static FScopedMesh AcquireCopy(const UE::Geometry::FDynamicMesh3& Source);
+
+	static FStats GetStats();
+	static void ResetStats();
+
+	/** Free meshes kept per thread; extras are freed on release. */
+	static constexpr int32 MaxMeshesPerThread = 8;
+
+	/** Meshes that grew past this many triangle slots are freed on release instead of pinning the memory. */
+	static constexpr int32 MaxRetainedTriangles = 200000;
+
+private:
+	static void Release(TUniquePtr<UE::Geometry::FDynamicMesh3>&& Mesh);
+};
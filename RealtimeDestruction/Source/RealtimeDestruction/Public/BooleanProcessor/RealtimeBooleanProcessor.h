@@ -13,9 +13,14 @@
 #include <atomic>
 #include "UObject/WeakObjectPtr.h"
 #include "Containers/Queue.h"
+#include "Containers/RingBuffer.h"
 #include "DynamicMesh/MeshTangents.h"
 #include "DynamicMesh/DynamicMesh3.h"
 #include "HAL/CriticalSection.h"
+#include "Tasks/Task.h"
+#include "BooleanProcessor/BooleanCostModel.h"
+#include "BooleanProcessor/BulletHoleQueue.h"
+#include "BooleanProcessor/MeshScratchPool.h"
 
 ////////////////////////////////////////
 /******** forward declaration ********/
@@ -32,6 +37,8 @@ enum class EGeometryScriptBooleanOperation : uint8;
 class URealtimeDestructibleMeshComponent;
 class UDecalComponent;
 class URDMThreadManagerSubsystem;
+class FRDMTaskSignal;
+enum class ERDMWorkPriority : uint8;
 ////////////////////////////////////////
 
 enum class EBooleanWorkType : uint8
@@ -61,7 +68,7 @@ struct FIslandRemovalContext
 /** Union result payload for a chunk, including the combined tool mesh and decals. */
 struct FUnionResult
 {
-	int32 BatchID = 0;				                     // For ordering
+	int32 BatchID = 0;				                     // Per-chunk sequence number (logging only)
 	UE::Geometry::FDynamicMesh3 PendingCombinedToolMesh; // Union result mesh
 	TArray<TWeakObjectPtr<UDecalComponent>> Decals;
 	int32 UnionCount = 0;
@@ -78,43 +85,69 @@ struct FUnionResult
 
 	/** Batch completion tracking ID array (multiple Ops may be unioned and processed together) */
 	TArray<int32> CompletionBatchIds;
+
+	/** Chunk work epoch the batch was queued under; bullet-hole work is dropped once it is superseded. */
+	int32 WorkEpoch = 0;
+	/** Worker time already spent on this batch, counted as wasted if it is dropped. */
+	double SpentMs = 0.0;
 };
 
-/** A single tool impact request queued for boolean processing. */
-struct FBulletHole
+/** Requests of one chunk waiting to be batched, oldest first. */
+struct FChunkPendingBucket
 {
-	// TODO: Consider switching to a SoA layout.
-	
-	FTransform ToolTransform = {};
-	uint8 Attempts = 0;
-	static constexpr uint8 MaxAttempts = 2;
-
-	// true: penetration, false: non-penetration
-	bool bIsPenetration = false;
-
-	TWeakObjectPtr<UDecalComponent> TemporaryDecal = nullptr;
+	TRingBuffer<FBulletHole> Ops;
 
-	TSharedPtr<UE::Geometry::FDynamicMesh3, ESPMode::ThreadSafe> ToolMeshPtr = nullptr;
-
-	TWeakObjectPtr<UDynamicMeshComponent> TargetMesh = nullptr;
+	/** Listed in the owning FPendingChunkOps::ActiveChunks. */
+	bool bActive = false;
+};
 
-	int32 ChunkIndex = INDEX_NONE;
+/**
+ * Per-chunk pending requests of one priority (GameThread only).
+ * The tick visits ActiveChunks instead of the whole backlog, so its cost scales with the
+ * number of chunks that have work rather than with queue length.
+ */
+struct FPendingChunkOps
+{
+	TArray<FChunkPendingBucket> Buckets;
 
-	/** Batch completion tracking ID (no tracking if INDEX_NONE) */
-	int32 BatchId = INDEX_NONE;
+	/** Chunks with pending requests, in the order they first received one. */
+	TArray<int32> ActiveChunks;
 
-	bool CanRetry() const { return Attempts <= MaxAttempts; }
+	void Initialize(int32 ChunkNum)
+	{
+		Reset();
+		Buckets.SetNum(ChunkNum);
+	}
 
 	void Reset()
 	{
-		ToolTransform = {};
-		Attempts = 0;
-		bIsPenetration = false;
-		TemporaryDecal = nullptr;
-		ToolMeshPtr = nullptr;
-		TargetMesh = nullptr;
-		ChunkIndex = INDEX_NONE;
-		BatchId = INDEX_NONE;
+		for (FChunkPendingBucket& Bucket : Buckets)
+		{
+			Bucket.Ops.Empty();
+			Bucket.bActive = false;
+		}
+		ActiveChunks.Reset();
+	}
+
+	/** Drains the request queue into the buckets. Requests for unknown chunks are dropped. */
+	void RouteFrom(FBulletHoleQueue& Queue)
+	{
+		FBulletHole Op;
+		while (Queue.Dequeue(Op))
+		{
+			if (!Buckets.IsValidIndex(Op.ChunkIndex) || !Op.TargetMesh.IsValid())
+			{
+				continue;
+			}
+
+			FChunkPendingBucket& Bucket = Buckets[Op.ChunkIndex];
+			if (!Bucket.bActive)
+			{
+				Bucket.bActive = true;
+				ActiveChunks.Add(Op.ChunkIndex);
+			}
+			Bucket.Ops.Add(MoveTemp(Op));
+		}
 	}
 };
 
@@ -125,11 +158,12 @@ struct FBulletHoleBatch
 	TArray<uint8> Attempts = {};
 	TArray<bool> bIsPenetrations = {};
 	TArray<TWeakObjectPtr<UDecalComponent>> TemporaryDecals = {};
-	TArray<TSharedPtr<UE::Geometry::FDynamicMesh3, ESPMode::ThreadSafe>> ToolMeshPtrs = {};
+	TArray<TSharedPtr<const UE::Geometry::FDynamicMesh3, ESPMode::ThreadSafe>> ToolMeshPtrs = {};
 	TArray<int32> CompletionBatchIds = {};  // For batch completion tracking
 
 	int32 Count = 0;
 	int32 ChunkIndex = INDEX_NONE;
+	int32 WorkEpoch = 0;  // Chunk work epoch at dispatch, carried into FUnionResult::WorkEpoch
 
 	FBulletHoleBatch() = default;
 	~FBulletHoleBatch() = default;
@@ -185,6 +219,36 @@ struct FBulletHoleBatch
 		Count++;
 	}
 
+	/** Keeps only the tools whose bit is set, preserving order. Completion IDs are kept for all of them. */
+	void KeepOnly(const TBitArray<>& Keep)
+	{
+		int32 WriteIndex = 0;
+		for (int32 ReadIndex = 0; ReadIndex < Count; ++ReadIndex)
+		{
+			if (!Keep[ReadIndex])
+			{
+				continue;
+			}
+
+			if (WriteIndex != ReadIndex)
+			{
+				ToolTransforms[WriteIndex] = MoveTemp(ToolTransforms[ReadIndex]);
+				Attempts[WriteIndex] = Attempts[ReadIndex];
+				bIsPenetrations[WriteIndex] = bIsPenetrations[ReadIndex];
+				TemporaryDecals[WriteIndex] = MoveTemp(TemporaryDecals[ReadIndex]);
+				ToolMeshPtrs[WriteIndex] = MoveTemp(ToolMeshPtrs[ReadIndex]);
+			}
+			++WriteIndex;
+		}
+
+		Count = WriteIndex;
+		ToolTransforms.SetNum(Count);
+		Attempts.SetNum(Count);
+		bIsPenetrations.SetNum(Count);
+		TemporaryDecals.SetNum(Count);
+		ToolMeshPtrs.SetNum(Count);
+	}
+
 	bool Get(FBulletHole& OutOp, int32 Index)
 	{
 		if (Index >= Count)
@@ -216,6 +280,24 @@ struct FChunkState
 	int32 DurationAccumCount = 0;
 	float SubtractDurationAccum = 0.0f;
 
+	/** Single-worker pipeline: a union for the next batch is running (GameThread only). */
+	bool bUnionInFlight = false;
+
+	/** Multi-worker: batches launched into the task pipeline and not yet applied; the chunk stays busy while > 0 (GameThread only). */
+	int32 PipelineDepth = 0;
+
+	/** Completes once the chunk's newest pipeline batch is applied; the next batch's subtract waits on it (GameThread only). */
+	UE::Tasks::FTask PipelineTail;
+
+	/** A background simplify job is running for this chunk (GameThread only). */
+	bool bSimplifyInFlight = false;
+
+	/** The owner is computing a split of this chunk; pending requests wait (GameThread only). */
+	bool bSplitInFlight = false;
+
+	/** Union of tool bounds applied since the last simplify; the next simplify is limited to it (GameThread only). */
+	UE::Geometry::FAxisAlignedBox3d DirtyBounds = UE::Geometry::FAxisAlignedBox3d::Empty();
+
 	void Reset()
 	{
 		Interval = 0;
@@ -231,14 +313,16 @@ struct FChunkProcessState
 	
 	void Initialize(int32 ChunkNum)
 	{
-		States.SetNumZeroed(ChunkNum);
+		States.SetNum(ChunkNum);
 	}
 
+	/** Full reset (mesh restored): also drops the damage regions waiting for simplify. */
 	void Reset()
 	{
 		for (FChunkState& State : States)
 		{
 			State.Reset();
+			State.DirtyBounds = UE::Geometry::FAxisAlignedBox3d::Empty();
 		}
 	}
 
@@ -306,6 +390,18 @@ public:
 	 */
 	void KickProcessIfNeededPerChunk();
 
+	/**
+	 * Applies finished boolean results on the GameThread, oldest first, until BudgetMs is spent.
+	 * The budget is shared by every processor of the game instance within a frame (tracked by
+	 * URDMThreadManagerSubsystem); each processor still applies at least one result per call
+	 * so no component starves. BudgetMs <= 0 drains everything.
+	 * @return Number of results applied.
+	 */
+	int32 DrainCompletionQueue(double BudgetMs);
+
+	/** Returns the number of finished results waiting to be applied on the GameThread. */
+	int32 GetPendingCompletionCount() const { return PendingCompletionCount.load(); }
+
 	/** Returns whether the owning URealtimeDestructibleMeshComponent is valid. */
 	bool IsOwnerCompValid() const { return OwnerComponent.IsValid(); }
 
@@ -317,6 +413,70 @@ public:
 	/** Resolves the chunk index from the component and returns its hole count. */
 	int32 GetChunkHoleCount(const UPrimitiveComponent* ChunkComponent) const;
 
+	/** Returns the current mesh generation of the chunk (version of its published snapshot). */
+	int32 GetChunkGeneration(int32 ChunkIndex) const
+	{
+		return ChunkGenerations.IsValidIndex(ChunkIndex) ? ChunkGenerations[ChunkIndex].load() : 0;
+	}
+
+	/**
+	 * Records an edit of the chunk mesh made outside the boolean apply path (fragment cleanup, split).
+	 * Background results computed from an older generation (simplify, split) are discarded. Returns the new generation.
+	 */
+	int32 BumpChunkGeneration(int32 ChunkIndex)
+	{
+		return ChunkGenerations.IsValidIndex(ChunkIndex) ? ChunkGenerations[ChunkIndex].fetch_add(1) + 1 : 0;
+	}
+
+	/**
+	 * Supersedes all bullet-hole work of the chunk (reset, revert, removal). Pending requests are skipped now;
+	 * running unions and subtracts notice at their next check and drop the rest of the work (GameThread).
+	 */
+	void CancelChunkWork(int32 ChunkIndex);
+
+	/** Tools skipped before the union because they could not change the mesh (all processors). */
+	static int64 GetCulledToolCount() { return CulledToolCount.load(std::memory_order_relaxed); }
+
+	/** Worker time spent on boolean work that was dropped because its chunk was superseded. */
+	double GetWastedBooleanMs() const { return WastedBooleanMicros.load(std::memory_order_relaxed) / 1000.0; }
+
+	/** Current per-chunk batch size limit (tools unioned into one subtract). */
+	int32 GetChunkUnionLimit(int32 ChunkIndex) const
+	{
+		return MaxUnionCount.IsValidIndex(ChunkIndex) ? MaxUnionCount[ChunkIndex] : 0;
+	}
+
+	/**
+	 * Telemetry: cost model prediction (ms) of a subtract with UnionCount tools on the chunk at its current size.
+	 * Returns a negative value until the chunk's model has enough samples.
+	 */
+	double PredictChunkBooleanCostMs(int32 ChunkIndex, int32 UnionCount) const;
+
+	/** Telemetry: prediction and measurement of the chunk's last subtract. Returns false without samples. */
+	bool GetChunkCostModelSample(int32 ChunkIndex, double& OutPredictedMs, double& OutMeasuredMs) const;
+
+	/**
+	 * True when batching can no longer keep the chunk's subtracts within FrameBudgetMs (a single tool is
+	 * predicted over it) or the chunk grew past URDMSetting::ChunkSplitTriangleCount. The owner splits such chunks.
+	 */
+	bool IsChunkOverBudget(int32 ChunkIndex) const;
+
+	/** No request, union, subtract or simplify of the chunk is queued or running (GameThread). */
+	bool IsChunkIdle(int32 ChunkIndex) const;
+
+	/** Holds the chunk's pending requests while its split is being computed (GameThread). */
+	void SetChunkSplitInFlight(int32 ChunkIndex, bool bInFlight);
+
+	/**
+	 * Called after the owner split ParentIndex into itself and ChildIndices (GameThread).
+	 * Resets the parent's cost history, prepares the children and moves pending requests
+	 * to the chunk that now owns their location.
+	 */
+	void OnChunkSplit(int32 ParentIndex, const TArray<int32>& ChildIndices);
+
+	/** Chunk slots with per-chunk state, including the room reserved for runtime splits. */
+	int32 GetChunkCapacity() const { return ChunkStates.States.Num(); }
+
 	/** Runs a mesh boolean and writes the result into OutputMesh. */
 	static bool ApplyMeshBooleanAsync(const UE::Geometry::FDynamicMesh3* TargetMesh,
 		const UE::Geometry::FDynamicMesh3* ToolMesh,
@@ -327,13 +487,37 @@ public:
 		const FTransform& ToolTransform = FTransform::Identity
 		);
 
+	/**
+	 * Subtracts ToolMesh from only the patch of ChunkMesh inside the tool's padded bounds,
+	 * then welds the cut patch back into the rest of the chunk (via ApplyToMeshRegion).
+	 * Returns false (OutputMesh undefined) when the patch is too large or the seam does not close,
+	 * in which case the caller should run a whole-chunk boolean instead.
+	 */
+	static bool ApplyLocalizedSubtractAsync(const UE::Geometry::FDynamicMesh3& ChunkMesh,
+		const UE::Geometry::FDynamicMesh3& ToolMesh,
+		UE::Geometry::FDynamicMesh3& OutputMesh,
+		const FGeometryScriptMeshBooleanOptions& Options,
+		float MaxPatchRatio);
+
 	/**
 	 * Applies planar simplification to clean up the mesh.
 	 * Removes low-importance vertices to prevent triangle count blow-up.
+	 * @param bFixBoundaryVertices Pin open edges and their vertices (used when simplifying an extracted region).
 	 */
 	static void ApplySimplifyToPlanarAsync(UE::Geometry::FDynamicMesh3* TargetMesh,
 		FGeometryScriptPlanarSimplifyOptions Options,
-		bool bEnableDetail);
+		bool bEnableDetail,
+		bool bFixBoundaryVertices = false);
+
+	/**
+	 * Planar simplification limited to the triangles touching Region; the rest of the mesh is left untouched.
+	 * Falls back to the whole mesh when the region covers more than MaxRegionRatio of the triangles.
+	 */
+	static void ApplySimplifyToPlanarRegionAsync(UE::Geometry::FDynamicMesh3* TargetMesh,
+		const UE::Geometry::FAxisAlignedBox3d& Region,
+		FGeometryScriptPlanarSimplifyOptions Options,
+		bool bEnableDetail,
+		float MaxRegionRatio);
 
 	/**
 	 * Applies uniform remeshing to reduce accumulated vertex count.
@@ -344,22 +528,105 @@ public:
 	 */
 	static void ApplyUniformRemesh(UE::Geometry::FDynamicMesh3* TargetMesh, double TargetEdgeLength, int32 NumPasses = 5);
 
+	/** ApplyUniformRemesh limited to the triangles touching Region (whole mesh above MaxRegionRatio). */
+	static void ApplyUniformRemeshRegion(UE::Geometry::FDynamicMesh3* TargetMesh,
+		const UE::Geometry::FAxisAlignedBox3d& Region,
+		double TargetEdgeLength,
+		int32 NumPasses,
+		float MaxRegionRatio);
+
+	/**
+	 * Extracts the triangles touching Region, runs RegionOp on them and welds the result back in place.
+	 * RegionOp must not move the region's open edges and returns false to abort. Returns false (TargetMesh
+	 * unchanged) when the region is empty, exceeds MaxRegionRatio of the mesh, RegionOp fails or the seam
+	 * does not close.
+	 */
+	static bool ApplyToMeshRegion(UE::Geometry::FDynamicMesh3& TargetMesh,
+		const UE::Geometry::FAxisAlignedBox3d& Region,
+		float MaxRegionRatio,
+		TFunctionRef<bool(UE::Geometry::FDynamicMesh3&)> RegionOp);
+
+	/** ApplyToMeshRegion writing to OutMesh (undefined on failure) and leaving SourceMesh untouched. */
+	static bool ApplyToMeshRegion(const UE::Geometry::FDynamicMesh3& SourceMesh,
+		const UE::Geometry::FAxisAlignedBox3d& Region,
+		float MaxRegionRatio,
+		TFunctionRef<bool(UE::Geometry::FDynamicMesh3&)> RegionOp,
+		UE::Geometry::FDynamicMesh3& OutMesh);
+
 private:	
 	// ===============================================================
 	// Processing Pipeline
 	// ===============================================================
 	void StartBooleanWorkerAsyncForChunk(FBulletHoleBatch&& InBatch, int32 Gen);	
-	void EnqueueRetryOps(TQueue<FBulletHole, EQueueMode::Mpsc>& Queue, FBulletHoleBatch&& InBatch,
-		UDynamicMeshComponent* TargetMesh, int32 ChunkIndex, int32& DebugCount);
+	/** Unions the next batch of a chunk whose subtract is still running; result waits in ChunkUnionResultsQueues. */
+	void StartUnionStageForChunk(FBulletHoleBatch&& InBatch);
+	void OnUnionStageCompleted(FUnionResult&& UnionResult);
+	/** Starts the subtract of the oldest staged union if the chunk is free (GameThread). */
+	void TryStartStagedSubtract(int32 ChunkIndex);
+	/** Transforms and unions the batch tools into OutResult (worker thread). */
+	bool BuildChunkUnionResult(FBulletHoleBatch&& Batch, FUnionResult& OutResult);
+	/**
+	 * Subtracts a union result from the chunk's latest snapshot and queues the GameThread apply (worker thread).
+	 * With AppliedSignal (task pipeline), the apply triggers it and releases the pipeline batch instead of the busy bit.
+	 */
+	void RunChunkSubtractStage(FUnionResult&& UnionResult, const FGeometryScriptMeshBooleanOptions& Options,
+		TSharedPtr<FRDMTaskSignal, ESPMode::ThreadSafe> AppliedSignal = nullptr);
+	/**
+	 * Multi-worker: launches the batch's union and subtract as ThreadManager tasks. The subtract's prerequisites are
+	 * its union and the apply of the chunk's previous batch, so the hand-off needs no GameThread round trip (GameThread).
+	 */
+	void LaunchChunkPipeline(FBulletHoleBatch&& Batch);
+	/** Whether another batch of the chunk may enter the task pipeline now (GameThread). */
+	bool CanExtendChunkPipeline(int32 ChunkIndex) const;
+	/** Called after a pipeline batch was applied; frees the chunk once no batch is left in flight (GameThread). */
+	void ReleaseChunkPipelineBatch(int32 ChunkIndex);
+	/**
+	 * Queues a request by priority. A penetration request that finds its queue full falls back to the
+	 * normal queue; if that is full too the request is rejected.
+	 */
+	bool PushBulletHole(FBulletHole&& Op);
+	/** Drops a request that could not be queued and releases its batch tracking. */
+	void RejectBulletHole(FBulletHole&& Op);
 	int32& GetChunkInterval(int32 ChunkIndex);	
+	/** Chunk subtract entry point: tries the localized patch boolean when enabled, otherwise the whole chunk. */
+	bool SubtractFromChunkMesh(const UE::Geometry::FDynamicMesh3& ChunkMesh,
+		const UE::Geometry::FDynamicMesh3& ToolMesh,
+		UE::Geometry::FDynamicMesh3& OutputMesh,
+		const FGeometryScriptMeshBooleanOptions& Options) const;
 	
 	// ===============================================================
 	// Simplification & Adaptive Tuning
 	// ===============================================================
 	void AccumulateSubtractDuration(int32 ChunkIndex, double CurrentSubDuration);
 	void UpdateSimplifyInterval(double CurrentSetMeshAvgCost, int32 ChunkIndex);
-	void UpdateUnionSize(int32 ChunkIndex, double DurationMs);
-	bool TrySimplify(UE::Geometry::FDynamicMesh3& WorkMesh, int32 ChunkIndex, int32 UnionCount, bool bEnableDetail);
+	/**
+	 * Feeds one subtract measurement to the chunk's cost model and resizes MaxUnionCount so the next batch
+	 * is predicted to land on the target latency. Falls back to the step heuristic until the model is ready.
+	 */
+	void UpdateUnionSize(int32 ChunkIndex, double DurationMs, int32 ChunkTriCount, int32 ToolTriCount, int32 UnionCount);
+	/**
+	 * Drops tools that cannot change the chunk: bounds outside the chunk, or only over grid cells with no
+	 * source geometry (GameThread, before the batch is dispatched). Returns the number of tools dropped.
+	 */
+	int32 CullToolsOutsideChunk(FBulletHoleBatch& Batch) const;
+	/**
+	 * Drops tools contained in another tool of the batch and near-identical repeats of an earlier tool.
+	 * Uses template bounds and transforms only, so it is cheap next to the union (worker thread).
+	 */
+	static int32 CoalesceBatchTools(FBulletHoleBatch& Batch);
+	/** True when the chunk's work epoch moved past WorkEpoch, i.e. the work is for a superseded chunk. */
+	bool IsChunkWorkStale(int32 ChunkIndex, int32 WorkEpoch) const;
+	void AddWastedBooleanMs(double Ms);
+	/** Advances the chunk's simplify triggers for a new subtract result; true when simplification is due. */
+	bool ShouldSimplify(int32 TriCount, int32 ChunkIndex, int32 UnionCount);
+	/**
+	 * Queues a low-priority planar simplify of the chunk's published mesh (GameThread).
+	 * The result is published only if the chunk generation has not moved; otherwise it re-runs.
+	 */
+	void RequestBackgroundSimplify(int32 ChunkIndex, bool bEnableDetail);
+	void LaunchBackgroundSimplify(int32 ChunkIndex, bool bEnableDetail, int32 Attempt, const UE::Geometry::FAxisAlignedBox3d& Region);
+	/** Grows the chunk's pending simplify region (GameThread). */
+	void AddChunkDirtyRegion(int32 ChunkIndex, const UE::Geometry::FAxisAlignedBox3d& Bounds);
 	/** Subtract cost tracker. */
 	void UpdateSubtractAvgCost(double CostMs);
 	
@@ -368,6 +635,8 @@ private:
 	// ===============================================================
 	// ThreadManager access helper
 	URDMThreadManagerSubsystem* GetThreadManager() const;
+	/** Visible while the owning actor was rendered recently; off-screen work yields to it in the ThreadManager. */
+	ERDMWorkPriority GetWorkPriority() const;
 
 	void InitializeSlots();
 	void ShutdownSlots();
@@ -376,11 +645,30 @@ private:
 	int32 FindLeastBusySlot() const;
 
 	// Start workers.
-	void KickUnionWorker(int32 SlotIndex);
 	void KickSubtractWorker(int32 SlotIndex);
 
-	// Worker main loop (batch passed as parameter for MPSC queue safety).
-	void ProcessSlotUnionWork(int32 SlotIndex, FBulletHoleBatch&& Batch);
+	/**
+	 * Reserves a worker on PreferredSlot, or on any other slot below MaxPerSlot when it is full.
+	 * @return Slot that owns the reserved worker, INDEX_NONE if every slot is at its cap.
+	 */
+	int32 ReserveWorkerSlot(TArray<TUniquePtr<std::atomic<int32>>>& WorkerCounts, int32 MaxPerSlot, int32 PreferredSlot) const;
+
+	/**
+	 * Takes the next runnable island-removal work item from SlotIndex's subtract queue, or steals one from
+	 * another slot. Runnable means the chunk is idle; the chunk busy bit is set for the returned item.
+	 * Skipped items go back to their own queue in order (GameThread).
+	 */
+	bool StealSubtractWork(int32 SlotIndex, FUnionResult& OutResult);
+
+	/**
+	 * Unions already-transformed tool meshes with a balanced pairwise (tree) reduction.
+	 * Pairs of each level are unioned in parallel on workers reserved from the thread manager,
+	 * so N tools finish in ceil(log2(N)) rounds instead of N-1 sequential unions.
+	 * Intermediate results are leased from the worker's FMeshScratchPool.
+	 * Stops between levels once WorkEpoch is stale, returning 0.
+	 * @return Number of tools merged into OutCombinedMesh (failed unions drop the right-hand side).
+	 */
+	int32 UnionToolMeshesTree(TArray<FMeshScratchPool::FScopedMesh>&& ToolMeshes, UE::Geometry::FDynamicMesh3& OutCombinedMesh, int32 ChunkIndex, int32 WorkEpoch);
 	void ProcessSlotSubtractWork(int32 SlotIndex, FUnionResult&& UnionResult);
 
 	// Clean up mapping when a slot drains.
@@ -388,6 +676,9 @@ private:
 
 	void BooleanOpSync(FBulletHole&& Op);
 
+	/** Queues a GameThread result apply from a worker; drained by DrainCompletionQueue. */
+	void EnqueueCompletion(TUniqueFunction<void()>&& Completion);
+
 private:
 	// ===============================================================
 	// Processing Pipeline
@@ -397,18 +688,30 @@ private:
 	TSharedPtr<FProcessorLifeTime, ESPMode::ThreadSafe> LifeTime;
 	
 	// Separate queues for penetration and non-penetration operations.
-	TQueue<FBulletHole, EQueueMode::Mpsc> HighPriorityQueue;
+	FBulletHoleQueue HighPriorityQueue;
 	int DebugHighQueueCount;
 
-	TQueue<FBulletHole, EQueueMode::Mpsc> NormalPriorityQueue;
+	FBulletHoleQueue NormalPriorityQueue;
 	int DebugNormalQueueCount;
 
+	// Queued requests routed per chunk, drained up to MaxUnionCount per tick.
+	FPendingChunkOps HighPriorityPending;
+	FPendingChunkOps NormalPriorityPending;
+
 	FChunkProcessState ChunkStates;
 	
 	// Chunk generation tracking.
 	// Incremented when a boolean result is applied to the mesh.
 	TArray<std::atomic<int32>> ChunkGenerations;
 
+	// Chunk work epoch, bumped by CancelChunkWork/CancelAllOperations.
+	// Bullet-hole work stamped with an older epoch is dropped at the next check.
+	TArray<std::atomic<int32>> ChunkWorkEpochs;
+	std::atomic<int64> WastedBooleanMicros{0};
+
+	/** Tools removed by CullToolsOutsideChunk/CoalesceBatchTools before reaching a union. */
+	static std::atomic<int64> CulledToolCount;
+
 	/** Per-chunk union result queues (independent pipelines per chunk). */
 	TArray<TUniquePtr<TQueue<FUnionResult, EQueueMode::Mpsc>>> ChunkUnionResultsQueues;
 
@@ -418,6 +721,15 @@ private:
 	// Max union count per chunk for tool meshes.
 	TArray<uint8> MaxUnionCount;
 
+	/** Per-chunk boolean cost models (guarded by CostModelLock; updated from workers). */
+	TArray<FBooleanCostModel> ChunkCostModels;
+	mutable FCriticalSection CostModelLock;
+
+	static constexpr int32 MaxUnionCountLimit = 20;
+
+	/** Batches are sized for this fraction of FrameBudgetMs, leaving headroom for misprediction. */
+	static constexpr double CostModelTargetRatio = 0.8;
+
 	TArray<int32> ChunkHoleCount = {};
 
 	bool bEnableMultiWorkers;
@@ -425,6 +737,10 @@ private:
 
 	TArray<TSharedPtr<UE::Geometry::FDynamicMesh3, ESPMode::ThreadSafe>> CachedChunkMeshes;
 
+	/** Finished results waiting for the GameThread (FIFO, applied under the frame budget). */
+	TQueue<TUniqueFunction<void()>, EQueueMode::Mpsc> CompletionQueue;
+	std::atomic<int32> PendingCompletionCount{ 0 };
+
 	// ===============================================================
 	// Simplification & Adaptive Tuning
 	// ===============================================================
@@ -434,6 +750,24 @@ private:
 	TArray<uint16> MaxInterval = {};
 	uint8 InitInterval = 0;
 
+	/** Background simplify re-runs at most this many times when new holes keep landing. */
+	static constexpr int32 MaxSimplifyAttempts = 3;
+
+	/** Region simplify falls back to the whole chunk above this fraction of its triangles. */
+	static constexpr float MaxSimplifyRegionRatio = 0.6f;
+
+	/** Tools are treated as repeats when their origins are closer than this fraction of the tool size. */
+	static constexpr double DuplicateToolDistanceRatio = 0.02;
+
+	/** Cell-footprint culling is skipped for tools that span more grid cells than this. */
+	static constexpr int32 MaxCullCellsPerTool = 64;
+
+	/** Seconds since the last render within which a destructible still counts as visible for worker priority. */
+	static constexpr float VisibleWorkTolerance = 0.5f;
+
+	/** Pipeline batches per chunk: one subtracting while the next unions, as in the single-worker pipeline. */
+	static constexpr int32 MaxChunkPipelineDepth = 2;
+
 	double SubDurationHighThreshold = 0.0;
 	double SubDurationLowThreshold = 5.0;
 
@@ -449,25 +783,20 @@ private:
 	// ===============================================================
 	// Slot count (worker management slots).
 	int32 NumSlots = 1;
+
+	// Cached for worker threads (avoids resolving World from a worker).
+	TWeakObjectPtr<URDMThreadManagerSubsystem> CachedThreadManager = nullptr;
 	
-	int32 MaxUnionWorkerPerSlot = 1;
+	// Derived from the thread manager budget in InitializeSlots.
 	int32 MaxSubtractWorkerPerSlot = 3;
 
 	// Debug/statistics only.
-	TArray<TUniquePtr<std::atomic<int32>>>SlotUnionWorkerCounts; 
 	TArray<TUniquePtr<std::atomic<int32>>> SlotSubtractWorkerCounts;
 	
-	// Per-slot union queues.
-	TArray<TUniquePtr<TQueue<FBulletHoleBatch, EQueueMode::Mpsc>>> SlotUnionQueues;
-
 	// Per-slot subtract queues.
 	TArray<TUniquePtr<TQueue<FUnionResult, EQueueMode::Mpsc>>> SlotSubtractQueues;
 	
 	FCriticalSection MapLock; 
-	
-	// Per-slot worker active flags.
-	TArray<TUniquePtr<std::atomic<bool>>> SlotUnionActiveFlags;
-	TArray<TUniquePtr<std::atomic<bool>>> SlotSubtractActiveFlags;	
 };
 
 
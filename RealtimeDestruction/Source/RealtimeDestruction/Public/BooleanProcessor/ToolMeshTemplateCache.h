@@ -0,0 +1,87 @@
+// Copyright (c) 2026 LazyDevelopers <lazydeveloper24@gmail.com>. All rights reserved.
+// This plugin is distributed under the Fab Standard License.
+//
+// This product was independently developed by us while participating in the Epic Project, a developer-support
+// program of the KRAFTON JUNGLE GameTech Lab. All rights, title, and interest in and to the product are exclusively
+// vested in us. Krafton, Inc. was not involved in its development and distribution and disclaims all representations
+// and warranties, express or implied, and assumes no responsibility or liability for any consequences arising from
+// the use of this product.
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Components/DestructionTypes.h"
+
+namespace UE::Geometry
+{
+	class FDynamicMesh3;
+}
+
+/**
+ * Process-wide cache of immutable tool mesh primitives.
+ *
+ * Tool meshes are generated in local space (identity transform) and keyed by shape and
+ * quantized shape parameters, so near-identical bullets share one template.
+ * The world transform is applied by the boolean workers on their own copy at union time.
+ * Safe to call from any thread.
+ */
+class REALTIMEDESTRUCTION_API FToolMeshTemplateCache
+{
+public:
+	static FToolMeshTemplateCache& Get();
+
+	/** Returns the shared template for the shape, generating it on first use. */
+	TSharedPtr<const UE::Geometry::FDynamicMesh3, ESPMode::ThreadSafe> FindOrCreate(
+		EDestructionToolShape ToolShape,
+		const FDestructionToolShapeParams& ShapeParams);
+
+	/** Drops all cached templates. Templates still referenced by in-flight requests stay alive. */
+	void Reset();
+
+	int32 Num() const;
+
+	/** Size step (cm) that radius and height are snapped to before lookup. */
+	static constexpr float QuantizeStep = 0.1f;
+
+	/** Cache is cleared when it grows past this many templates. */
+	static constexpr int32 MaxTemplates = 256;
+
+private:
+	struct FTemplateKey
+	{
+		EDestructionToolShape Shape = EDestructionToolShape::Cylinder;
+		int32 QuantizedRadius = 0;
+		int32 QuantizedHeight = 0;
+		int32 Steps0 = 0;
+		int32 Steps1 = 0;
+		bool bCapped = false;
+
+		bool operator==(const FTemplateKey& Other) const
+		{
+			return Shape == Other.Shape
+				&& QuantizedRadius == Other.QuantizedRadius
+				&& QuantizedHeight == Other.QuantizedHeight
+				&& Steps0 == Other.Steps0
+				&& Steps1 == Other.Steps1
+				&& bCapped == Other.bCapped;
+		}
+
+		friend uint32 GetTypeHash(const FTemplateKey& Key)
+		{
+			uint32 Hash = GetTypeHash(static_cast<uint8>(Key.Shape));
+			Hash = HashCombineFast(Hash, GetTypeHash(Key.QuantizedRadius));
+			Hash = HashCombineFast(Hash, GetTypeHash(Key.QuantizedHeight));
+			Hash = HashCombineFast(Hash, GetTypeHash(Key.Steps0));
+			Hash = HashCombineFast(Hash, GetTypeHash(Key.Steps1));
+			return HashCombineFast(Hash, GetTypeHash(Key.bCapped));
+		}
+	};
+
+	static FTemplateKey MakeKey(EDestructionToolShape ToolShape, const FDestructionToolShapeParams& ShapeParams);
+	static TSharedPtr<const UE::Geometry::FDynamicMesh3, ESPMode::ThreadSafe> BuildTemplate(const FTemplateKey& Key);
+
+	mutable FRWLock TemplateLock;
+	TMap<FTemplateKey, TSharedPtr<const UE::Geometry::FDynamicMesh3, ESPMode::ThreadSafe>> Templates;
+};
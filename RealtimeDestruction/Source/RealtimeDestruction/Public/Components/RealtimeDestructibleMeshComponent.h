@@ -14,8 +14,11 @@
 #include "GeometryScript/MeshBooleanFunctions.h"
 #include "DestructionTypes.h"
 #include "StructuralIntegrity/GridCellTypes.h"
+#include "BooleanProcessor/ChunkSplitter.h"
 #include "PhysicsEngine/BodySetup.h"
 #include "PhysicsEngine/BodyInstance.h"
+#include "HAL/CriticalSection.h"
+#include "Tasks/Task.h"
 #include "RealtimeDestructibleMeshComponent.generated.h"
 
 class UBoxComponent;
@@ -28,6 +31,7 @@ class FLifetimeProperty;
 class FRealtimeBooleanProcessor;
 class UBulletClusterComponent;
 class UImpactProfileDataAsset;
+struct FDetachAnalysisJob;
 class ADebrisActor;
 
 //////////////////////////////////////////////////////////////////////////
@@ -60,7 +64,7 @@ struct REALTIMEDESTRUCTION_API FRealtimeDestructionRequest
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh")
 	int32 RandomSeed = 0;
 
-	TSharedPtr<FDynamicMesh3, ESPMode::ThreadSafe> ToolMeshPtr = {};
+	TSharedPtr<const FDynamicMesh3, ESPMode::ThreadSafe> ToolMeshPtr = {};
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh")
 	EDestructionToolShape ToolShape = EDestructionToolShape::Cylinder;
@@ -283,6 +287,21 @@ struct FCollisionChunkData
 };
 
 
+/**
+ * Immutable, ref-counted view of a chunk mesh for boolean workers.
+ * Workers hold the handle instead of deep-copying the chunk; the game thread
+ * publishes a new version by swapping the pointer.
+ */
+struct FChunkMeshSnapshot
+{
+	TSharedPtr<const FDynamicMesh3, ESPMode::ThreadSafe> Mesh = nullptr;
+
+	/** Boolean processor ChunkGenerations value this snapshot was published at */
+	int32 Generation = INDEX_NONE;
+
+	bool IsValid() const { return Mesh.IsValid(); }
+};
+
 struct FMeshSectionData
 {
 	TArray<FVector> Vertices;           // Vertex positions (relative to MeshCenter)
@@ -407,6 +426,19 @@ public:
 
 	FConnectivityContext CellContext;
 
+	/** Anchor distance field kept between incremental detach checks (invalidated on grid rebuild). */
+	FIncrementalConnectivityCache IncrementalConnectivity;
+
+	/** In-flight detach analysis; at most one, and it owns IncrementalConnectivity while running. */
+	TSharedPtr<FDetachAnalysisJob, ESPMode::ThreadSafe> DetachAnalysisJob;
+	UE::Tasks::FTask DetachAnalysisTask;
+
+	/** Seed cells gathered while a detach analysis was in flight (launched when it completes). */
+	TArray<int32> PendingDetachSeedCells;
+
+	/** Bumped on grid rebuild so detach results computed on an older grid are discarded. */
+	uint32 CellStateEpoch = 0;
+
 	/** Server validation: Range limit */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh|Advanced|Validation")
 	float MaxDestructionRange = 5000.0f;
@@ -556,14 +588,16 @@ public:
 	FRealtimeBooleanProcessor* GetBooleanProcessor() const { return BooleanProcessor.Get(); }
 	TSharedPtr<FRealtimeBooleanProcessor, ESPMode::ThreadSafe> GetBooleanProcessorShared() { return BooleanProcessor; }
 
-	/** Recreate ToolMeshPtr from ShapeParams (used when receiving over network) */
-	TSharedPtr<FDynamicMesh3, ESPMode::ThreadSafe> CreateToolMeshPtrFromShapeParams(
+	/** Get the shared tool mesh template for ShapeParams (used when receiving over network) */
+	TSharedPtr<const FDynamicMesh3, ESPMode::ThreadSafe> CreateToolMeshPtrFromShapeParams(
 		EDestructionToolShape ToolShape,
 		const FDestructionToolShapeParams& ShapeParams);
 	float GetAngleThreshold() const { return AngleThreshold; }
 	double GetSubtractDurationLimit() const { return SubtractDurationLimit; }
 	int32 GetInitInterval() const { return InitInterval; }
 	bool IsHighDetailMode() const { return bEnableHighDetail;}
+	bool IsLocalizedBooleanEnabled() const { return bEnableLocalizedBoolean; }
+	float GetLocalizedBooleanMaxPatchRatio() const { return LocalizedBooleanMaxPatchRatio; }
 
 	void ApplyRenderUpdate();
 	void ApplyCollisionUpdate(UDynamicMeshComponent* TargetComp);
@@ -586,12 +620,37 @@ public:
 
 	bool GetChunkMesh(FDynamicMesh3& OutMesh, int32 ChunkIndex) const;
 
+	/**
+	 * Returns a shared read-only snapshot of the chunk mesh without copying it (thread-safe).
+	 * If no snapshot has been published yet, one is built from the chunk mesh and cached.
+	 */
+	bool AcquireChunkMeshSnapshot(int32 ChunkIndex, FChunkMeshSnapshot& OutSnapshot) const;
+
+	/** Swaps in a new chunk mesh version (GameThread, after the mesh itself was applied) */
+	void PublishChunkMeshSnapshot(int32 ChunkIndex, TSharedPtr<const FDynamicMesh3, ESPMode::ThreadSafe>&& Mesh, int32 Generation);
+
+	/** Drops the cached snapshot after the chunk mesh was edited outside the boolean pipeline */
+	void InvalidateChunkMeshSnapshot(int32 ChunkIndex);
+
+	void InvalidateAllChunkMeshSnapshots();
+
 	bool CheckAndSetChunkBusy(int32 ChunkIndex);
 
+	bool IsChunkBusy(int32 ChunkIndex) const;
+
 	void FindChunksInRadius(const FVector& WorldCenter, float Radius, TArray<int32>& OutChunkIndices, bool bAppend = false);
 	
 	void FindChunksAlongLine(const FVector& WorldStart, const FVector& WorldEnd, float Radius, TArray<int32>& OutChunkIndices, bool bAppend = false);
 
+	/** Queue an over-budget chunk for a runtime split; it is split once none of its boolean work is pending (GameThread) */
+	void RequestChunkSplit(int32 ChunkIndex);
+
+	/**
+	 * Chunk that owns LocalPosition (component local) after runtime splits of ChunkIndex
+	 * @return ChunkIndex itself if it was never split or still owns the position
+	 */
+	int32 ResolveSplitChunk(int32 ChunkIndex, const FVector& LocalPosition) const;
+
 	// Bit operations are not atomic, logic modification needed when calling outside GT
 	void ClearChunkBusy(int32 ChunkIndex);
 
@@ -611,6 +670,12 @@ public:
 	// Function to update collision async with target mesh idle or desired delay
 	void RequestDelayedCollisionUpdate(UDynamicMeshComponent* TargetComp);		
 
+	/** Queue a render buffer rebuild for the chunk; coalesced and flushed from TickComponent */
+	void RequestChunkRenderUpdate(int32 ChunkIndex);
+
+	/** Rebuild render buffers of pending chunks whose RenderUpdateMinInterval has elapsed (all of them if bForce) */
+	void FlushChunkRenderUpdates(bool bForce = false);
+
 	/*************************************************/
 	void SetSourceMeshEnabled(bool bSwitch);
 	
@@ -641,6 +706,21 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh|ChunkMesh")
 	TObjectPtr<UGeometryCollection> CachedGeometryCollection;
 
+	/**
+	 * Cook chunk collision on the async physics cooker into a new body setup,
+	 * swapped in on the GameThread when cooking finishes (old collision stays active meanwhile).
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh|ChunkMesh")
+	bool bAsyncChunkCollisionCooking = true;
+
+	/** Quiet time (seconds) after the last boolean on a chunk before its collision is rebuilt */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh|ChunkMesh", meta = (ClampMin = 0.0))
+	float CollisionUpdateDelay = 0.05f;
+
+	/** Upper bound (seconds) a continuously hit chunk may postpone its collision rebuild */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh|ChunkMesh", meta = (ClampMin = 0.0))
+	float CollisionUpdateMaxDelay = 0.3f;
+
 
 
 	//////////////////////////////////////////////////////////////////////////
@@ -676,6 +756,26 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh|MeshBoolean")
 	bool bEnableHighDetail = false;
 
+	/**
+	 * Subtract only the patch of the chunk around the tool and weld it back,
+	 * so per-shot cost scales with the hole instead of the whole chunk.
+	 * Falls back to a whole-chunk boolean when the patch cannot be stitched cleanly.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh|MeshBoolean")
+	bool bEnableLocalizedBoolean = false;
+
+	/** Above this fraction of the chunk's triangles, the localized path is skipped in favor of a whole-chunk boolean. */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh|MeshBoolean", meta = (ClampMin = 0.0, ClampMax = 1.0, EditCondition = "bEnableLocalizedBoolean"))
+	float LocalizedBooleanMaxPatchRatio = 0.5f;
+
+	/**
+	 * Minimum time (seconds) between render buffer rebuilds of the same chunk.
+	 * Boolean results applied within the interval update mesh data only and share one rebuild.
+	 * 0 = rebuild once per frame.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh|MeshBoolean", meta = (ClampMin = 0.0, UIMax = 0.25))
+	float RenderUpdateMinInterval = 0.033f;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh|MeshBoolean", meta = (ClampMin = 0.001))
 	float AngleThreshold = 0.001f;
 
@@ -703,9 +803,35 @@ protected:
 
 	TArray<uint64> ChunkBusyBits;
 
+	/** Runtime splits: chunk -> chunks split off it (the chunk keeps one part). GridToChunkMap keeps pointing at the original chunk */
+	TMap<int32, TArray<int32>> ChunkSplitChildren;
+
+	/** Region (component local) owned by each chunk after a runtime split; invalid for chunks never split */
+	TArray<FBox> ChunkSplitRegions;
+
+	/** Chunks reported over budget, split once they are idle */
+	TSet<int32> PendingChunkSplits;
+
+	/** Chunk whose split is being computed on a worker (one at a time) */
+	int32 SplittingChunkIndex = INDEX_NONE;
+
+	/** Chunks too small for another grid-aligned split */
+	TSet<int32> UnsplittableChunks;
+
 	/** For Multi Worker, Subtract checking */
 	TArray<uint64> ChunkSubtractBusyBits;
 
+	/** Per-chunk read-only snapshots shared with boolean workers (guarded by ChunkSnapshotLock) */
+	mutable TArray<FChunkMeshSnapshot> ChunkMeshSnapshots;
+
+	mutable FCriticalSection ChunkSnapshotLock;
+
+	/** Chunks whose mesh changed but whose render buffers have not been rebuilt yet */
+	TSet<int32> PendingRenderUpdateChunks;
+
+	/** Last render buffer rebuild time (world seconds) per chunk */
+	TMap<int32, double> ChunkRenderUpdateTimes;
+
 	/** Whether chunk meshes are valid (build complete) */
 	UPROPERTY()
 	bool bChunkMeshesValid = false;
@@ -730,6 +856,10 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh|StructuralIntegrity")
 	bool bEnableStructuralIntegrity = true;
 
+	/** Run detach connectivity analysis on a worker against a cell state snapshot (game thread only applies the result) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "RealtimeDestructibleMesh|StructuralIntegrity", meta = (EditCondition = "bEnableStructuralIntegrity"))
+	bool bAsyncStructuralIntegrity = true;
+
 	/** Quantized destruction input history (for NarrowPhase) */
 	UPROPERTY()
 	TArray<FQuantizedDestructionInput> DestructionInputHistory;
@@ -823,6 +953,18 @@ private:
 
 	void FindChunksAlongLineInternal(const FVector& WorldStart, const FVector& WorldEnd, TArray<int32>& OutChunkIndices);
 
+	/** Add ChunkIndex and the chunks split off it whose region overlaps LocalBounds (component local) */
+	void AppendSplitChunks(int32 ChunkIndex, const FBox& LocalBounds, TArray<int32>& OutChunkIndices) const;
+
+	/** Start splitting one idle queued chunk on a worker (called from TickComponent) */
+	void ProcessPendingChunkSplits();
+
+	/** Apply a finished split: the chunk keeps the first part, the others become new chunks */
+	void FinishChunkSplit(int32 ChunkIndex, int32 SourceGeneration, TArray<FChunkSplitter::FPart>&& Parts);
+
+	/** Create a chunk component next to SourceChunk with the same attachment, materials and collision */
+	UDynamicMeshComponent* CreateSplitChunkComponent(UDynamicMeshComponent* SourceChunk, int32 NewChunkIndex);
+
 public:
 	/** Get GridCellLayout (read-only) */
 	const FGridCellLayout& GetGridCellLayout() const { return GridCellLayout; }
@@ -844,12 +986,36 @@ public:
 	FDestructionResult DestructionLogic(const FRealtimeDestructionRequest& Request);
 	void DisconnectedCellStateLogic(const TArray< FDestructionResult>& AllResults, bool bForceRun = false);
 
+	/** Detach, debris and cleanup step for cells found disconnected (game thread). */
+	void ApplyDetachedCells(const TSet<int32>& DisconnectedCells, const TArray<TArray<int32>>& NewDetachedGroups);
+
+	/** Launch a detach analysis for PendingDetachSeedCells if none is in flight. */
+	void LaunchDetachAnalysis();
+
+	/** Apply a finished detach analysis (called from Tick) and launch the next one. */
+	void PollDetachAnalysis();
+
+	/**
+	 * Wait for the in-flight detach analysis and apply it (before synchronous connectivity work).
+	 * A job still queued is cancelled instead and its seeds returned to PendingDetachSeedCells.
+	 */
+	void FlushDetachAnalysis();
+
+	/** Cancel the in-flight detach analysis (waiting only if it already started), dropping its result and pending seeds. */
+	void CancelDetachAnalysis();
+
 	float CalculateDebrisBoundsExtent(const TArray<int32>& CellIds) const;
 
 	/**
 	 * Function used for arbitrary destruction (currently called based on bullet count in Supercell)
 	 */
 	void ForceRemoveSupercell(int32 SuperCellId);
+
+	/**
+	 * Cancels queued and in-flight bullet-hole booleans of chunks left without any alive cell
+	 * @param RemovedCellIds - Cells just destroyed; only their chunks are checked
+	 */
+	void CancelBooleanWorkForEmptiedChunks(const TArray<int32>& RemovedCellIds);
 	
 	UFUNCTION(NetMulticast, Reliable)  
 	void MulticastForceRemoveSupercell(int32 SuperCellId);
@@ -1123,7 +1289,16 @@ protected:
 
 private:
 	
-	FTimerHandle CollisionUpdateTimerHandle;
+	/** Per-chunk collision debounce timers, so a hit on one chunk does not postpone another */
+	TMap<int32, FTimerHandle> ChunkCollisionTimerHandles;
+
+	/** World time of the oldest still-pending collision request per chunk */
+	TMap<int32, double> ChunkCollisionFirstRequestTimes;
+
+	void OnChunkCollisionTimer(int32 ChunkIndex);
+
+	/** Route mesh edits to deferred collision and enable async cooking on a chunk component */
+	void ConfigureChunkCollisionCooking(UDynamicMeshComponent* ChunkComp) const;
 
 	/** Delayed fragment cleanup timer handle */
 	FTimerHandle FragmentCleanupTimerHandle;
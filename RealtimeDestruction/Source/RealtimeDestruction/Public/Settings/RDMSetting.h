@@ -68,6 +68,48 @@ public:
 		EditCondition = "ThreadMode == ERDMThreadMode::Percentage", EditConditionHides))
 	int32 ThreadPercentage = 50;
 
+	// Per-frame GameThread time for applying finished boolean results, shared by all destructible meshes.
+	// Results that do not fit are applied on later frames, oldest first. 0 = no limit.
+	UPROPERTY(config, EditAnywhere, Category = "Thread Settings", meta = (DisplayName = "Result Apply Budget (ms)", ClampMin = "0.0", UIMin = "0.0", UIMax = "16.0"))
+	float ResultApplyBudgetMs = 4.0f;
+
+	// Slots in each destructible mesh's penetration / non-penetration request queue (rounded up to a power of two).
+	// When both are full, new requests are skipped instead of growing the queue.
+	UPROPERTY(config, EditAnywhere, Category = "Thread Settings", meta = (DisplayName = "Boolean Request Queue Capacity", ClampMin = "64", UIMin = "64", UIMax = "16384"))
+	int32 BooleanRequestQueueCapacity = 2048;
+
+	// Share of the worker budget each work class may occupy at once, so one kind of work cannot hold every worker.
+	UPROPERTY(config, EditAnywhere, Category = "Thread Settings", meta = (DisplayName = "Union Worker Cap (%)", ClampMin = "1", ClampMax = "100", UIMin = "1", UIMax = "100"))
+	int32 UnionWorkerCapPercentage = 75;
+
+	UPROPERTY(config, EditAnywhere, Category = "Thread Settings", meta = (DisplayName = "Subtract Worker Cap (%)", ClampMin = "1", ClampMax = "100", UIMin = "1", UIMax = "100"))
+	int32 SubtractWorkerCapPercentage = 100;
+
+	UPROPERTY(config, EditAnywhere, Category = "Thread Settings", meta = (DisplayName = "Island Removal Worker Cap (%)", ClampMin = "1", ClampMax = "100", UIMin = "1", UIMax = "100"))
+	int32 IslandRemovalWorkerCapPercentage = 50;
+
+	UPROPERTY(config, EditAnywhere, Category = "Thread Settings", meta = (DisplayName = "Simplify Worker Cap (%)", ClampMin = "1", ClampMax = "100", UIMin = "1", UIMax = "100"))
+	int32 SimplifyWorkerCapPercentage = 25;
+
+	// Off-screen work that has waited this long is served ahead of visible work, so it is delayed but never starved.
+	UPROPERTY(config, EditAnywhere, Category = "Thread Settings", meta = (DisplayName = "Off-Screen Max Wait (s)", ClampMin = "0.0", UIMin = "0.0", UIMax = "5.0"))
+	float OffScreenMaxWaitSeconds = 0.5f;
+
+	// Split a chunk into grid-aligned parts at runtime once its booleans stop fitting the frame budget
+	// (even a single tool is predicted over budget) or it grows past the triangle limit. Standalone only.
+	UPROPERTY(config, EditAnywhere, Category = "Chunk Split Settings", meta = (DisplayName = "Enable Runtime Chunk Split"))
+	bool bEnableRuntimeChunkSplit = true;
+
+	// Triangle count above which a damaged chunk is split even if its booleans are still fast enough. 0 = cost only.
+	UPROPERTY(config, EditAnywhere, Category = "Chunk Split Settings", meta = (DisplayName = "Split Triangle Count", ClampMin = "0", UIMin = "0",
+		EditCondition = "bEnableRuntimeChunkSplit"))
+	int32 ChunkSplitTriangleCount = 150000;
+
+	// Chunks that runtime splits may add per destructible mesh. Per-chunk state is reserved for them up front.
+	UPROPERTY(config, EditAnywhere, Category = "Chunk Split Settings", meta = (DisplayName = "Max Split Chunks", ClampMin = "0", UIMin = "0", UIMax = "256",
+		EditCondition = "bEnableRuntimeChunkSplit"))
+	int32 MaxRuntimeSplitChunks = 64;
+
 	// Returns calculated available threads depends on thread mode
 	int32 GetEffectiveThreadCount() const ;
 	
@@ -37,7 +37,7 @@ public:
 		const FGridCellLayout& Cache,
 		const FQuantizedDestructionInput& Shape,
 		const FTransform& MeshTransform,
-		const TSet<int32>& DestroyedCells);
+		const FCellBitSet& DestroyedCells);
 
 	/**
 	 * Calculate destroyed cell IDs from a destruction shape.
@@ -86,9 +86,9 @@ public:
 	 * Find cells detached from anchors (unified API).
 	 *
 	 * Selects the implementation based on bEnableSupercell/bEnableSubcell:
-	 * - SuperCell enabled: hierarchical BFS (SuperCell + Cell/SubCell)
+	 * - SubCell disabled: word-parallel cell-level flood fill
+	 * - SubCell + SuperCell enabled: hierarchical BFS (SuperCell + SubCell)
 	 * - SubCell only: subcell-level BFS
-	 * - Both disabled: cell-level BFS
 	 *
 	 * @param Cache - grid layout
 	 * @param SupercellState - SuperCell state (used when bEnableSupercell=true)
@@ -105,6 +105,22 @@ public:
 		bool bEnableSubcell,
 		FConnectivityContext& Context);
 
+	/**
+	 * <<<Cell Level API, word-parallel>>>
+	 * Find cells detached from anchors, 64 cells per operation.
+	 * Prefer calling via FindDisconnectedCells.
+	 *
+	 * Repacks CellExistsBits/DestroyedCells/CellIsAnchorBits into row-aligned 64-bit words (one row per X line),
+	 * floods X runs with shift/mask fills, and propagates Y/Z as row-word ORs over a dirty-row worklist until no row grows.
+	 *
+	 * @param Cache - grid layout
+	 * @param DestroyedCells - destroyed cell set
+	 * @return Set of detached cell IDs
+	 */
+	static TSet<int32> FindDisconnectedCellsWordParallel(
+		const FGridCellLayout& Cache,
+		const FCellBitSet& DestroyedCells);
+
 	/**
 	 * <<<Cell Level API>>>
 	 * Find cells detached from anchors.
@@ -116,7 +132,7 @@ public:
 	 */
 	static TSet<int32> FindDisconnectedCellsCellLevel(
 		const FGridCellLayout& Cache,
-		const TSet<int32>& DestroyedCells);
+		const FCellBitSet& DestroyedCells);
 
 	/**
 	 * <<<SubCell Level API>>>
@@ -169,6 +185,45 @@ public:
 		bool bEnableSupercell,
 		bool bEnableSubcell );
 
+	/**
+	 * Incremental detach check seeded from cells next to new damage.
+	 *
+	 * Each seed first tries to prove itself through the cached anchor distance field.
+	 * Otherwise a DFS grows its island until it reaches an anchor or a proven cell
+	 * (the island is then written back into the field) or runs out of cells (the island is detached).
+	 * An island larger than MaxIslandCells, or an unbuilt cache, falls back to RebuildAnchorConnectivity.
+	 *
+	 * @param Cache - grid layout
+	 * @param CellState - cell state
+	 * @param AffectedNeighborCells - alive neighbors of newly destroyed/damaged cells
+	 * @param Connectivity - distance field and scratch buffers kept between calls
+	 * @param bEnableSubcell - whether to use subcell boundary connectivity
+	 * @param MaxIslandCells - island size bound before the full rebuild is used
+	 * @return Set of detached cell IDs
+	 */
+	static TSet<int32> FindDisconnectedCellsIncremental(
+		const FGridCellLayout& Cache,
+		const FCellState& CellState,
+		const TArray<int32>& AffectedNeighborCells,
+		FIncrementalConnectivityCache& Connectivity,
+		bool bEnableSubcell,
+		int32 MaxIslandCells = FIncrementalConnectivityCache::DefaultMaxIslandCells);
+
+	/**
+	 * Rebuild the anchor distance field with a cell-level BFS from every alive anchor.
+	 *
+	 * @param Cache - grid layout
+	 * @param CellState - cell state
+	 * @param Connectivity - cache to rebuild
+	 * @param bEnableSubcell - whether to use subcell boundary connectivity
+	 * @return Set of detached cell IDs (alive cells the BFS did not reach)
+	 */
+	static TSet<int32> RebuildAnchorConnectivity(
+		const FGridCellLayout& Cache,
+		const FCellState& CellState,
+		FIncrementalConnectivityCache& Connectivity,
+		bool bEnableSubcell);
+
 	static bool SupercellContainsAnchor(
 		int32 SupercellId,
 		const FGridCellLayout& Cache,
@@ -196,7 +251,7 @@ public:
 	static TArray<TArray<int32>> GroupDetachedCells(
 		const FGridCellLayout& Cache,
 		const TSet<int32>& DisconnectedCells,
-		const TSet<int32>& DestroyedCells);
+		const FCellBitSet& DestroyedCells);
 	
 	//=========================================================================
 	// Utilities
@@ -224,7 +279,7 @@ public:
 	static bool IsBoundaryCell(
 		const FGridCellLayout& Cache,
 		int32 CellId,
-		const TSet<int32>& DestroyedCells);
+		const FCellBitSet& DestroyedCells);
 };
 
 /**
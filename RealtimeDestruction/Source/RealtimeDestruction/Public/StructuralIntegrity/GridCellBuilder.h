@@ -45,7 +45,7 @@ public:
 		const FVector& CellSize,
 		float AnchorHeightThreshold,
 		FGridCellLayout& OutLayout,
-		TMap<int32, FSubCell>* OutSubCellStates = nullptr
+		FSubCellMaskArray* OutSubCellStates = nullptr
 		);
 
 	/**
@@ -121,11 +121,6 @@ private:
 		const UE::Geometry::FDynamicMesh3& Mesh,
 		FGridCellLayout& OutLayout);
 
-	/**
-	 * Calculate adjacency (6 directions).
-	 */
-	static void CalculateNeighbors(FGridCellLayout& OutLayout);
-
 	/**
 	 * Determine anchor cells.
 	 */
@@ -158,7 +153,7 @@ private:
 	static void VoxelizeWithTriangles(
 		const UStaticMesh* SourceMesh,
 		FGridCellLayout& OutLayout,
-		TMap<int32, FSubCell>* OutSubCellStates);
+		FSubCellMaskArray* OutSubCellStates);
 
 	/** Voxelize a single triangle (with optional SubCell support). */
 	static void VoxelizeTriangle(
@@ -166,14 +161,14 @@ private:
 		const FVector& V1,
 		const FVector& V2,
 		FGridCellLayout& OutLayout,
-		TMap<int32, FSubCell>* OutSubCellStates);
+		FSubCellMaskArray* OutSubCellStates);
 
 	/** Voxelize from vertex/index arrays (for cached data). */
 	static void VoxelizeFromArrays(
 		const TArray<FVector>& Vertices,
 		const TArray<uint32>& Indices,
 		FGridCellLayout& OutLayout,
-		TMap<int32, FSubCell>* OutSubCellStates);
+		FSubCellMaskArray* OutSubCellStates);
 
 
 	static void FillInsideVoxels(FGridCellLayout& OutLayout);
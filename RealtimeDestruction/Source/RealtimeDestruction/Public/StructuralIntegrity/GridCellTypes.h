@@ -80,6 +80,24 @@ struct FIntArray
 	TArray<int32>::RangedForConstIteratorType end() const { return Values.end(); }
 };
 
+/**
+ * Fixed-capacity neighbor list for a grid cell (at most 6 face neighbors).
+ * Returned by value; neighbors are derived from the cell existence bitfield.
+ */
+struct FCellNeighborList
+{
+	int32 Ids[6];
+	int32 Count = 0;
+
+	void Add(int32 Value) { Ids[Count++] = Value; }
+	int32 Num() const { return Count; }
+	const int32& operator[](int32 Index) const { return Ids[Index]; }
+
+	// Range-based for loop support
+	const int32* begin() const { return Ids; }
+	const int32* end() const { return Ids + Count; }
+};
+
 /**
  * Oriented Bounding Box (OBB) for subcells.
  * Represents a rotated box in world space.
@@ -310,21 +328,25 @@ struct REALTIMEDESTRUCTION_API FGridCellLayout
 	// Sparse array data (valid cells only)
 	//=========================================================================
 
-	/** Valid cell ID -> sparse index mapping. */
+	/**
+	 * Valid cell ID -> sparse index mapping (1 int32 per 32 cells).
+	 * Holds the number of existing cells before each CellExistsBits word, so the
+	 * sparse index of a cell is its rank in the bitfield.
+	 */
 	UPROPERTY()
-	TMap<int32, int32> CellIdToSparseIndex;
+	TArray<int32> CellRankPrefix;
 
-	/** Sparse index -> cell ID reverse mapping. */
+	/** Sparse index -> cell ID reverse mapping (sorted by cell ID). */
 	UPROPERTY()
 	TArray<int32> SparseIndexToCellId;
 
-	/** Sparse array: per-cell triangle indices (valid cells only). */
+	/** CSR offsets into CellTriangleData (valid cell count + 1, empty if no triangles were assigned). */
 	UPROPERTY()
-	TArray<FIntArray> SparseCellTriangles;
+	TArray<int32> CellTriangleOffsets;
 
-	/** Sparse array: per-cell neighbor IDs (valid cells only). */
+	/** CSR data: triangle indices of all valid cells, grouped by sparse index. */
 	UPROPERTY()
-	TArray<FIntArray> SparseCellNeighbors;
+	TArray<int32> CellTriangleData;
 
 	//=========================================================================
 	// Cached triangle data (for runtime voxelization)
@@ -403,68 +425,89 @@ struct REALTIMEDESTRUCTION_API FGridCellLayout
 	// Sparse array accessors
 	//=========================================================================
 
-	/** Get triangle index array for a cell (empty if none). */
-	const FIntArray& GetCellTriangles(int32 CellId) const
+	/** Get sparse index of a valid cell (INDEX_NONE if the cell does not exist). */
+	FORCEINLINE int32 GetSparseIndex(int32 CellId) const
 	{
-		const int32* SparseIdx = CellIdToSparseIndex.Find(CellId);
-		if (SparseIdx && SparseCellTriangles.IsValidIndex(*SparseIdx))
+		if (!GetCellExists(CellId))
 		{
-			return SparseCellTriangles[*SparseIdx];
+			return INDEX_NONE;
 		}
-		static const FIntArray EmptyArray;
-		return EmptyArray;
+		const int32 WordIndex = CellId >> 5;
+		const uint32 LowerMask = (1u << (CellId & 31)) - 1u;
+		return CellRankPrefix.IsValidIndex(WordIndex)
+			? CellRankPrefix[WordIndex] + FMath::CountBits(CellExistsBits[WordIndex] & LowerMask)
+			: INDEX_NONE;
 	}
 
-	/** Get neighbor array for a cell (empty if none). */
-	const FIntArray& GetCellNeighbors(int32 CellId) const
+	/** Get triangle indices for a cell (empty if none). */
+	TConstArrayView<int32> GetCellTriangles(int32 CellId) const
 	{
-		const int32* SparseIdx = CellIdToSparseIndex.Find(CellId);
-		if (SparseIdx && SparseCellNeighbors.IsValidIndex(*SparseIdx))
+		const int32 SparseIdx = GetSparseIndex(CellId);
+		if (SparseIdx == INDEX_NONE || !CellTriangleOffsets.IsValidIndex(SparseIdx + 1))
 		{
-			return SparseCellNeighbors[*SparseIdx];
+			return TConstArrayView<int32>();
 		}
-		static const FIntArray EmptyArray;
-		return EmptyArray;
+		const int32 Begin = CellTriangleOffsets[SparseIdx];
+		return TConstArrayView<int32>(CellTriangleData.GetData() + Begin, CellTriangleOffsets[SparseIdx + 1] - Begin);
 	}
 
-	/** Get mutable triangle index array for a cell. */
-	FIntArray* GetCellTrianglesMutable(int32 CellId)
+	/** Get existing face neighbors of a cell (+X, -X, +Y, -Y, +Z, -Z order). */
+	FCellNeighborList GetCellNeighbors(int32 CellId) const
 	{
-		const int32* SparseIdx = CellIdToSparseIndex.Find(CellId);
-		if (SparseIdx && SparseCellTriangles.IsValidIndex(*SparseIdx))
+		FCellNeighborList Neighbors;
+		if (!GetCellExists(CellId))
 		{
-			return &SparseCellTriangles[*SparseIdx];
+			return Neighbors;
 		}
-		return nullptr;
-	}
 
-	/** Get mutable neighbor array for a cell. */
-	FIntArray* GetCellNeighborsMutable(int32 CellId)
-	{
-		const int32* SparseIdx = CellIdToSparseIndex.Find(CellId);
-		if (SparseIdx && SparseCellNeighbors.IsValidIndex(*SparseIdx))
+		const int32 StrideY = GridSize.X;
+		const int32 StrideZ = GridSize.X * GridSize.Y;
+		const FIntVector Coord = IdToCoord(CellId);
+
+		auto TryAdd = [this, &Neighbors](int32 NeighborId)
 		{
-			return &SparseCellNeighbors[*SparseIdx];
-		}
-		return nullptr;
+			if (GetCellExists(NeighborId))
+			{
+				Neighbors.Add(NeighborId);
+			}
+		};
+
+		if (Coord.X + 1 < GridSize.X) { TryAdd(CellId + 1); }
+		if (Coord.X > 0)              { TryAdd(CellId - 1); }
+		if (Coord.Y + 1 < GridSize.Y) { TryAdd(CellId + StrideY); }
+		if (Coord.Y > 0)              { TryAdd(CellId - StrideY); }
+		if (Coord.Z + 1 < GridSize.Z) { TryAdd(CellId + StrideZ); }
+		if (Coord.Z > 0)              { TryAdd(CellId - StrideZ); }
+		return Neighbors;
 	}
 
-	/** Register a valid cell (add to sparse arrays). */
-	int32 RegisterValidCell(int32 CellId)
+	/**
+	 * Register a valid cell (marks it as existing).
+	 * Sparse indices are assigned by FinalizeSparseData() once voxelization is done.
+	 */
+	void RegisterValidCell(int32 CellId)
 	{
-		if (CellIdToSparseIndex.Contains(CellId))
+		if (!IsValidCellId(CellId) || GetCellExists(CellId))
 		{
-			return CellIdToSparseIndex[CellId];
+			return;
 		}
 
-		const int32 SparseIndex = SparseIndexToCellId.Num();
-		CellIdToSparseIndex.Add(CellId, SparseIndex);
+		SetCellExists(CellId, true);
 		SparseIndexToCellId.Add(CellId);
-		SparseCellTriangles.AddDefaulted();
-		SparseCellNeighbors.AddDefaulted();
-		return SparseIndex;
 	}
 
+	/**
+	 * Build the rank table and sorted sparse -> cell ID mapping from CellExistsBits.
+	 * Call after all cells are registered; clears triangle CSR data.
+	 */
+	void FinalizeSparseData();
+
+	/**
+	 * Build triangle CSR arrays.
+	 * @param TriangleCellIds  Owning cell ID per triangle index (INDEX_NONE to skip)
+	 */
+	void BuildCellTriangles(TConstArrayView<int32> TriangleCellIds);
+
 	/** Valid cell count. */
 	int32 GetValidCellCount() const
 	{
@@ -491,8 +534,8 @@ struct REALTIMEDESTRUCTION_API FGridCellLayout
 	bool HasValidSparseData() const
 	{
 		return SparseIndexToCellId.Num() > 0 &&
-		       SparseCellTriangles.Num() == SparseIndexToCellId.Num() &&
-		       SparseCellNeighbors.Num() == SparseIndexToCellId.Num();
+		       CellRankPrefix.Num() == CellExistsBits.Num() &&
+		       (CellTriangleOffsets.Num() == 0 || CellTriangleOffsets.Num() == SparseIndexToCellId.Num() + 1);
 	}
 
 	//=========================================================================
@@ -693,6 +736,173 @@ struct FSubCell
 	}
 };
 
+static_assert(sizeof(FSubCell) == sizeof(uint8), "FSubCell must stay one byte for the dense subcell mask array");
+
+/**
+ * Dense per-cell bitset (one bit per cell ID, packed into 32-bit words).
+ * Drop-in for the TSet<int32> cell sets used by the connectivity code: Contains is a single bit test
+ * and the storage can be copied with a memcpy.
+ */
+USTRUCT()
+struct REALTIMEDESTRUCTION_API FCellBitSet
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<uint32> Words;
+
+	/** Number of set bits. */
+	UPROPERTY()
+	int32 Count = 0;
+
+	/** Size for a grid and clear all bits. */
+	void Init(int32 TotalCells)
+	{
+		Words.SetNumUninitialized((TotalCells + 31) >> 5);
+		FMemory::Memzero(Words.GetData(), sizeof(uint32) * Words.Num());
+		Count = 0;
+	}
+
+	FORCEINLINE bool Contains(int32 CellId) const
+	{
+		const int32 WordIndex = CellId >> 5;  // CellId / 32
+		const uint32 BitMask = 1u << (CellId & 31);  // CellId % 32
+		return CellId >= 0 && WordIndex < Words.Num() && (Words[WordIndex] & BitMask) != 0;
+	}
+
+	/** Set a bit (grows when the set was not sized for this cell). */
+	FORCEINLINE void Add(int32 CellId)
+	{
+		if (CellId < 0)
+		{
+			return;
+		}
+
+		const int32 WordIndex = CellId >> 5;
+		const uint32 BitMask = 1u << (CellId & 31);
+		if (WordIndex >= Words.Num())
+		{
+			Words.SetNumZeroed(WordIndex + 1);
+		}
+
+		if ((Words[WordIndex] & BitMask) == 0)
+		{
+			Words[WordIndex] |= BitMask;
+			++Count;
+		}
+	}
+
+	FORCEINLINE void Remove(int32 CellId)
+	{
+		const int32 WordIndex = CellId >> 5;
+		const uint32 BitMask = 1u << (CellId & 31);
+		if (CellId >= 0 && WordIndex < Words.Num() && (Words[WordIndex] & BitMask) != 0)
+		{
+			Words[WordIndex] &= ~BitMask;
+			--Count;
+		}
+	}
+
+	int32 Num() const
+	{
+		return Count;
+	}
+
+	bool IsEmpty() const
+	{
+		return Count == 0;
+	}
+
+	/** Clear all bits, keeping the allocation. */
+	void Reset()
+	{
+		FMemory::Memzero(Words.GetData(), sizeof(uint32) * Words.Num());
+		Count = 0;
+	}
+
+	/** Clear all bits and release the allocation. */
+	void Empty()
+	{
+		Words.Empty();
+		Count = 0;
+	}
+
+	/** Set cell IDs in ascending order. */
+	TArray<int32> Array() const
+	{
+		TArray<int32> Result;
+		Result.Reserve(Count);
+		for (int32 WordIndex = 0; WordIndex < Words.Num(); ++WordIndex)
+		{
+			uint32 Word = Words[WordIndex];
+			while (Word != 0)
+			{
+				const int32 Bit = FMath::CountTrailingZeros(Word);
+				Result.Add((WordIndex << 5) | Bit);
+				Word &= Word - 1;
+			}
+		}
+		return Result;
+	}
+};
+
+/**
+ * Dense subcell state (one FSubCell byte per cell ID).
+ * Cells never damaged keep 0xFF (all subcells alive), matching the old "no entry" state.
+ */
+USTRUCT()
+struct REALTIMEDESTRUCTION_API FSubCellMaskArray
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FSubCell> Masks;
+
+	/** Size for a grid with all subcells alive. */
+	void Init(int32 TotalCells)
+	{
+		Masks.SetNumUninitialized(TotalCells);
+		FMemory::Memset(Masks.GetData(), 0xFF, sizeof(FSubCell) * Masks.Num());
+	}
+
+	FORCEINLINE const FSubCell* Find(int32 CellId) const
+	{
+		return Masks.IsValidIndex(CellId) ? &Masks[CellId] : nullptr;
+	}
+
+	FORCEINLINE FSubCell* Find(int32 CellId)
+	{
+		return Masks.IsValidIndex(CellId) ? &Masks[CellId] : nullptr;
+	}
+
+	/** Mutable state for a cell (grows when the array was not sized for this cell). */
+	FORCEINLINE FSubCell& FindOrAdd(int32 CellId)
+	{
+		check(CellId >= 0);
+		if (CellId >= Masks.Num())
+		{
+			const int32 OldNum = Masks.Num();
+			Masks.SetNumUninitialized(CellId + 1);
+			FMemory::Memset(Masks.GetData() + OldNum, 0xFF, sizeof(FSubCell) * (Masks.Num() - OldNum));
+		}
+		return Masks[CellId];
+	}
+
+	/** Forget damage on a cell (back to all subcells alive). */
+	FORCEINLINE void Remove(int32 CellId)
+	{
+		if (Masks.IsValidIndex(CellId))
+		{
+			Masks[CellId].Reset();
+		}
+	}
+
+	void Empty()
+	{
+		Masks.Empty();
+	}
+};
+
 // =======================================================
 // Destruction Results & State
 // =======================================================
@@ -755,21 +965,32 @@ struct REALTIMEDESTRUCTION_API FCellState
 {
 	GENERATED_BODY()
 
-	/** Set of fully destroyed cell IDs. */
+	/** Fully destroyed cell IDs (dense bitset sized from the grid layout). */
 	UPROPERTY()
-	TSet<int32> DestroyedCells;
+	FCellBitSet DestroyedCells;
 
 	/** Detached cell groups (not yet spawned as debris). */
 	UPROPERTY()
 	TArray<FDetachedGroupWithSubCell> DetachedGroups;
 
 	/**
-	 * Subcell state storage.
-	 * Cells touched by a destruction shape gain dead subcells and are added here.
-	 * Cells not added here have all subcells alive.
+	 * Subcell state storage (one mask byte per cell).
+	 * Cells touched by a destruction shape gain dead subcells here.
+	 * Untouched cells keep 0xFF (all subcells alive).
 	 */
 	UPROPERTY()
-	TMap<int32, FSubCell> SubCellStates;
+	FSubCellMaskArray SubCellStates;
+
+	/** Size the dense storage for a grid layout. */
+	void InitializeForLayout(const FGridCellLayout& GridLayout)
+	{
+		const int32 TotalCells = GridLayout.GetTotalCellCount();
+		DestroyedCells.Init(TotalCells);
+		if (SubCellStates.Masks.Num() != TotalCells)
+		{
+			SubCellStates.Init(TotalCells);
+		}
+	}
 
 	/** Check if a cell is destroyed. */
 	bool IsCellDestroyed(int32 CellId) const
@@ -893,7 +1114,7 @@ struct REALTIMEDESTRUCTION_API FCellState
 	/** Reset state. */
 	void Reset()
 	{
-		DestroyedCells.Empty();
+		DestroyedCells.Reset();
 		DetachedGroups.Empty();
 	}
 };
@@ -1418,4 +1639,90 @@ struct FConnectivityContext
 			}
 		}
 	}
+};
+
+/**
+ * Connectivity state kept between incremental detach checks.
+ *
+ * AnchorDistance is a cell-level distance field toward the nearest anchor. It is only a hint:
+ * a cell counts as connected once a walk along strictly decreasing distances reaches an alive
+ * anchor under the current cell state, so stale entries cost time but never correctness.
+ * Stamp arrays avoid clearing per-cell flags between queries.
+ */
+struct FIncrementalConnectivityCache
+{
+	static constexpr int32 UnknownDistance = MAX_int32;
+
+	/** Island size above which the incremental search gives up and the field is rebuilt. */
+	static constexpr int32 DefaultMaxIslandCells = 4096;
+
+	TArray<int32> AnchorDistance = {};
+
+	/** Per-query marks, valid when equal to CurrentStamp. */
+	TArray<uint32> VisitStamp = {};
+	TArray<uint32> ProvenStamp = {};
+	TArray<uint32> FailedStamp = {};
+
+	/** Island search tree (parent cell of each visited cell). */
+	TArray<int32> SearchParent = {};
+	TArray<int32> VisitOrder = {};
+	TArray<int32> WorkStack = {};
+
+	/** Verification walk stack: X = cell, Y = next direction to try. */
+	TArray<FIntPoint> VerifyStack = {};
+
+	uint32 CurrentStamp = 0;
+	int32 CachedCellCount = 0;
+	bool bBuilt = false;
+
+	bool IsBuiltFor(int32 TotalCells) const
+	{
+		return bBuilt && CachedCellCount == TotalCells;
+	}
+
+	/** Drop the distance field (grid rebuilt or cell state reset). */
+	void Invalidate()
+	{
+		bBuilt = false;
+	}
+
+	/** Size arrays for the grid and mark every distance unknown. */
+	void Allocate(int32 TotalCells)
+	{
+		if (CachedCellCount != TotalCells || AnchorDistance.Num() != TotalCells)
+		{
+			AnchorDistance.SetNumUninitialized(TotalCells);
+			VisitStamp.SetNumZeroed(TotalCells);
+			ProvenStamp.SetNumZeroed(TotalCells);
+			FailedStamp.SetNumZeroed(TotalCells);
+			SearchParent.SetNumUninitialized(TotalCells);
+			CurrentStamp = 0;
+			CachedCellCount = TotalCells;
+		}
+
+		for (int32& Distance : AnchorDistance)
+		{
+			Distance = UnknownDistance;
+		}
+	}
+
+	/** Start a new query; per-cell marks from previous queries become stale. */
+	void BeginQuery()
+	{
+		++CurrentStamp;
+		if (CurrentStamp == 0)
+		{
+			// Wrapped around: clear so old stamps cannot alias the new one
+			FMemory::Memzero(VisitStamp.GetData(), sizeof(uint32) * VisitStamp.Num());
+			FMemory::Memzero(ProvenStamp.GetData(), sizeof(uint32) * ProvenStamp.Num());
+			FMemory::Memzero(FailedStamp.GetData(), sizeof(uint32) * FailedStamp.Num());
+			CurrentStamp = 1;
+		}
+		VisitOrder.Reset();
+		WorkStack.Reset();
+	}
+
+	FORCEINLINE bool IsVisited(int32 CellId) const { return VisitStamp[CellId] == CurrentStamp; }
+	FORCEINLINE bool IsProven(int32 CellId) const { return ProvenStamp[CellId] == CurrentStamp; }
+	FORCEINLINE bool IsFailed(int32 CellId) const { return FailedStamp[CellId] == CurrentStamp; }
 };
\ No newline at end of file
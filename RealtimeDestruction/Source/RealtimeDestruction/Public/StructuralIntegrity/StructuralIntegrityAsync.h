@@ -12,9 +12,53 @@
 #include "CoreMinimal.h"
 #include "Async/AsyncWork.h"
 #include "StructuralIntegrity/StructuralIntegrityTypes.h"
+#include "StructuralIntegrity/GridCellTypes.h"
+#include <atomic>
 
 class FStructuralIntegritySystem;
 
+/**
+ * Detach analysis (connectivity + grouping) run on a worker against a cell state snapshot.
+ *
+ * The result is stamped with the grid epoch and destroyed cell count of the snapshot,
+ * so the game thread can apply it, or discard and recompute it when newer destruction touched it.
+ */
+struct REALTIMEDESTRUCTION_API FDetachAnalysisJob
+{
+	/** Input: copy of the cell state at launch (never written after launch) */
+	FCellState Snapshot;
+	TArray<int32> SeedCells;
+	bool bEnableSubcell = false;
+
+	/** Snapshot stamp */
+	uint32 StateEpoch = 0;
+	int32 DestroyedCellCount = 0;
+
+	/** Output (valid once the task completed with bCompleted set) */
+	TSet<int32> DisconnectedCells;
+	TArray<TArray<int32>> DetachedGroups;
+	bool bCompleted = false;
+
+	/** Set by the game thread when the owner is torn down; a job that has not started skips the work */
+	std::atomic<bool> bCancelled{ false };
+
+	/** Set by Run before it checks bCancelled */
+	std::atomic<bool> bStarted{ false };
+
+	/**
+	 * Cancel the job (game thread).
+	 * @return true if Run already started and may still use the owner's layout/connectivity, so the caller must wait.
+	 *         false if Run will return without touching them (e.g. the job is still queued behind other work).
+	 */
+	bool Cancel();
+
+	/**
+	 * Run the analysis (worker thread).
+	 * GridLayout and Connectivity belong to the owner, which leaves them untouched while the job is in flight.
+	 */
+	void Run(const FGridCellLayout& GridLayout, FIncrementalConnectivityCache& Connectivity);
+};
+
 /**
  * Async Cell Destruction Task
  *
@@ -11,14 +11,72 @@
 
 #include "CoreMinimal.h"
 #include "Containers/Queue.h"
+#include "Tasks/Task.h"
 #include "Subsystems/GameInstanceSubsystem.h"
 #include "RDMThreadManagerSubsystem.generated.h"
 
+/** Kind of work a request performs. Each class has its own pending queues, concurrency cap and metrics. */
+enum class ERDMWorkClass : uint8
+{
+	Subtract,
+	Union,
+	IslandRemoval,
+	/** Background planar simplify; served after every other class. */
+	Simplify,
+	Num
+};
+
+/** Urgency of a request. Visible work is dispatched before off-screen work of any class. */
+enum class ERDMWorkPriority : uint8
+{
+	Visible,
+	OffScreen,
+	Num
+};
+
 struct FRDMWorkerRequest
 {
 	TFunction<void()> WorkFunc;
-	int32 Priority = 0;
+	ERDMWorkClass WorkClass = ERDMWorkClass::Subtract;
+	ERDMWorkPriority Priority = ERDMWorkPriority::Visible;
 	TWeakObjectPtr<UObject> Requester; // For tracking the requesting component
+	double EnqueueTime = 0.0;
+};
+
+/**
+ * One-shot completion signal usable as a UE::Tasks prerequisite.
+ * Fires on Trigger() or, if never triggered, on destruction, so tasks waiting on dropped work still run.
+ */
+class REALTIMEDESTRUCTION_API FRDMTaskSignal
+{
+public:
+	FRDMTaskSignal();
+	~FRDMTaskSignal();
+
+	FRDMTaskSignal(const FRDMTaskSignal&) = delete;
+	FRDMTaskSignal& operator=(const FRDMTaskSignal&) = delete;
+
+	void Trigger();
+
+	/** Completes once the signal fired. */
+	const UE::Tasks::FTask& GetTask() const { return Task; }
+
+private:
+	UE::Tasks::FTaskEvent Event;
+	UE::Tasks::FTask Task;
+	std::atomic<bool> bTriggered{ false };
+};
+
+/** Queue-depth and wait-time metrics of one work class. */
+struct FRDMWorkClassStats
+{
+	int32 Pending = 0;
+	int32 Active = 0;
+	int32 MaxWorkers = 0;
+	/** Exponential moving average of the time between RequestWork and launch. */
+	double AvgWaitMs = 0.0;
+	double MaxWaitMs = 0.0;
+	int64 DispatchedCount = 0;
 };
 
 UCLASS(ClassGroup = (RealtimeDestruction))
@@ -38,36 +96,128 @@ public:
 	// Thread Request Interface
 	void RequestWork(TFunction<void()>&& WorkFunc, UObject* Requester);
 
+	/**
+	 * Queues work under a class and priority. Pending work is dispatched visible first, then by class order,
+	 * round-robin over requesters within a class, and never past the class's concurrency cap.
+	 */
+	void RequestWork(TFunction<void()>&& WorkFunc, UObject* Requester, ERDMWorkClass WorkClass, ERDMWorkPriority Priority);
+
+	/**
+	 * Queues work once every task in Prerequisites has completed, with the same scheduling as RequestWork.
+	 * Waiting on prerequisites does not hold a worker.
+	 * @return Task that completes after WorkFunc ran, or after the request was dropped (shutdown).
+	 */
+	UE::Tasks::FTask RequestTask(TFunction<void()>&& WorkFunc, UObject* Requester, ERDMWorkClass WorkClass, ERDMWorkPriority Priority,
+		const TArray<UE::Tasks::FTask>& Prerequisites = {});
+
+	/**
+	 * Reserves up to Desired extra workers from the global budget for fork-join work
+	 * that a running worker wants to split (e.g. one level of a union reduction).
+	 * @return Number of workers actually granted (may be 0).
+	 */
+	int32 TryReserveWorkers(int32 Desired);
+
+	/** Returns workers obtained from TryReserveWorkers and dispatches pending work. */
+	void ReleaseReservedWorkers(int32 Count);
+
+	/**
+	 * GameThread time spent applying boolean results in the current frame, shared by every
+	 * destructible mesh of this game instance (GameThread only). Starts at 0 on each new frame.
+	 */
+	double GetResultApplySpentMs();
+	void AddResultApplySpentMs(double Ms);
+
 	// Settings
-	void SetMaxTotalWorkers(int32 Max) { MaxTotalWorkers = FMath::Max(1, Max); }
+	void SetMaxTotalWorkers(int32 Max) { MaxTotalWorkers = FMath::Max(1, Max); UpdateClassCaps(); }
 	int32 GetMaxTotalWorkers() const { return MaxTotalWorkers; }
 	int32 GetActiveWorkerCount() const { return ActiveWorkers.load(); }
 	int32 GetPendingCount() const { return PendingCount.load(); }
 
-	int32 GetSlotCount () const {return (MaxTotalWorkers >= 8) ? 2 : 1; }
+	/** Caps how many workers WorkClass may occupy at once (clamped to 1..MaxTotalWorkers). */
+	void SetClassMaxWorkers(ERDMWorkClass WorkClass, int32 Max);
+	FRDMWorkClassStats GetClassStats(ERDMWorkClass WorkClass) const;
+
+	/** One slot per WorkersPerSlot workers of the budget (idle slots steal from busy ones). */
+	int32 GetSlotCount () const {return FMath::Clamp(MaxTotalWorkers / WorkersPerSlot, 1, MaxSlotCount); }
 	// Logging
 	void LogStatus() const;
 private:
+	/** Pending requests of one requester, served FIFO. */
+	struct FRequesterQueue
+	{
+		TWeakObjectPtr<UObject> Requester;
+		TUniquePtr<TQueue<FRDMWorkerRequest>> Requests;
+		int32 Num = 0;
+	};
+
+	/** Pending requests of one class and priority, served round-robin over requesters. */
+	struct FClassQueue
+	{
+		TArray<FRequesterQueue> Requesters;
+		int32 NextRequester = 0;
+		int32 Num = 0;
+	};
+
 	// Actual execution
-	void LaunchWork(TFunction<void()>&& WorkFunc);
+	void LaunchWork(FRDMWorkerRequest&& Request);
 
 	// Completion handling
-	void OnWorkComplete();
+	void OnWorkComplete(ERDMWorkClass WorkClass);
 
 	// Execute next task from pending queue
 	void TryDispatchPending();
+
+	/** Picks the queue to serve next, or nullptr when nothing is runnable. Requires QueueLock. */
+	FClassQueue* SelectQueue(double Now);
+
+	/** Pops the next requester's oldest request from Queue (round-robin). Requires QueueLock. */
+	bool PopRequest(FClassQueue& Queue, FRDMWorkerRequest& OutRequest);
+
+	/** Applies the worker cap percentages from URDMSetting to MaxTotalWorkers. */
+	void UpdateClassCaps();
+
+	void RecordWait(ERDMWorkClass WorkClass, double WaitMs);
+
+	static constexpr int32 NumWorkClasses = static_cast<int32>(ERDMWorkClass::Num);
+	static constexpr int32 NumWorkPriorities = static_cast<int32>(ERDMWorkPriority::Num);
+
+	FClassQueue& GetQueue(ERDMWorkClass WorkClass, ERDMWorkPriority Priority)
+	{
+		return PendingQueues[static_cast<int32>(Priority)][static_cast<int32>(WorkClass)];
+	}
 	
 private:
 	// Global thread limit
 	int32 MaxTotalWorkers = 4;  // Maximum 4 workers for the entire game
 
+	static constexpr int32 WorkersPerSlot = 4;
+	static constexpr int32 MaxSlotCount = 16;
+
 	// Current active worker count
 	std::atomic<int32> ActiveWorkers{ 0 };
 
-	// Pending queue
-	TQueue<TFunction<void()>, EQueueMode::Mpsc> PendingQueue;
+	// Pending queues, [Priority][WorkClass]. Guarded by QueueLock (requests and completions arrive from any thread).
+	FClassQueue PendingQueues[NumWorkPriorities][NumWorkClasses];
+	mutable FCriticalSection QueueLock;
 	std::atomic<int32> PendingCount{ 0 };
 
+	// Per-class concurrency caps and counters
+	int32 ClassMaxWorkers[NumWorkClasses] = {};
+	std::atomic<int32> ClassActiveWorkers[NumWorkClasses] = {};
+	std::atomic<int32> ClassPendingCount[NumWorkClasses] = {};
+
+	// Per-class wait metrics (guarded by QueueLock)
+	double ClassAvgWaitMs[NumWorkClasses] = {};
+	double ClassMaxWaitMs[NumWorkClasses] = {};
+	int64 ClassDispatchedCount[NumWorkClasses] = {};
+
+	/** Off-screen queue heads older than this are served before visible work. */
+	double OffScreenMaxWaitSeconds = 0.5;
+
+	/** Result apply time already spent in ResultApplyFrame (GameThread only). */
+	uint64 ResultApplyFrame = 0;
+	double ResultApplySpentMs = 0.0;
+
 	// Shutdown flag
 	std::atomic<bool> bIsShuttingDown{ false };
 